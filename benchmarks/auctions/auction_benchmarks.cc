@@ -0,0 +1,311 @@
+#include <benchmark/benchmark.h>
+
+#include <cstdint>
+#include <random>
+#include <string>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#include "auctions/all_pay.h"
+#include "auctions/common_value_endpoints.h"
+#include "auctions/common_value_endpoints2.h"
+#include "auctions/common_value_signal.h"
+#include "auctions/common_value_signal_endpoints.h"
+#include "auctions/common_value_signal_second.h"
+#include "auctions/first_price.h"
+#include "auctions/first_price_2d.h"
+#include "auctions/first_price_reverse.h"
+#include "auctions/second_price.h"
+#include "genericga/multipop/ga.h"
+#include "genericga/random.h"
+#include "numericaldists/distribution.h"
+#include "numericaldists/distribution_ops.h"
+#include "numericaldists/grid.h"
+#include "numericaldists/grid_multi.h"
+#include "numericaldists/piecewise_linear.h"
+#include "numericaldists/scatter.h"
+
+#include <boost/math/distributions/uniform.hpp>
+#include <eigen3/Eigen/Core>
+
+namespace {
+
+using namespace auctions;
+using namespace numericaldists;
+using boost::math::uniform_distribution;
+using genericga::multipop::HasPrecalculate;
+using Eigen::ArrayXd;
+using Eigen::ArrayXXd;
+
+// Every environment is built with its constructor defaults and scored on
+// bid functions that are a canonical strategy plus uniform jitter.  The
+// jitter for bid function i is drawn from its own Philox substream of a fixed
+// key, so runs and machines see the same bids.
+constexpr std::uint64_t kSeed = 20200214;
+constexpr int kBatchSize = 50;
+
+ArrayXXd Jitter(int rows, int cols, double scale, int i) {
+  genericga::Philox4x32 gen(kSeed, 0, 0, i);
+  std::uniform_real_distribution<double> dist(-scale, scale);
+  return ArrayXXd::NullaryExpr(rows, cols, [&]() { return dist(gen); });
+}
+
+ArrayXd Jitter(int size, double scale, int i) {
+  return Jitter(size, 1, scale, i);
+}
+
+std::vector<Distribution> UniformValues(int n_players, double low,
+                                        double high) {
+  return std::vector<Distribution>(n_players,
+                                   uniform_distribution<>(low, high));
+}
+
+// n_players players with values on [0, 1], shading as in equilibrium.  Past
+// kMaxProductFactors players GetFitness falls back from the exact integral to
+// the trapezoid grid.
+template <int n_players>
+struct FirstPriceCase {
+  using Env = FirstPrice;
+  using Bid = Scatter;
+  static constexpr int kPlayers = n_players;
+  static Env Make() { return Env(UniformValues(kPlayers, 0, 1)); }
+  static Bid MakeBid(int i) {
+    ArrayXd values = ArrayXd::LinSpaced(101, 0, 1);
+    return {values, values * (kPlayers - 1) / kPlayers + Jitter(101, 0.01, i)};
+  }
+};
+
+struct SecondPriceCase {
+  using Env = SecondPrice;
+  using Bid = Scatter;
+  static constexpr int kPlayers = 2;
+  static Env Make() { return Env(UniformValues(kPlayers, 0, 1)); }
+  static Bid MakeBid(int i) {
+    ArrayXd values = ArrayXd::LinSpaced(101, 0, 1);
+    return {values, values + Jitter(101, 0.01, i)};
+  }
+};
+
+struct AllPayCase {
+  using Env = AllPay;
+  using Bid = Scatter;
+  static constexpr int kPlayers = 2;
+  static Env Make() { return Env(UniformValues(kPlayers, 0, 1)); }
+  static Bid MakeBid(int i) {
+    ArrayXd values = ArrayXd::LinSpaced(101, 0, 1);
+    return {values, values.square() / 2 + Jitter(101, 0.01, i)};
+  }
+};
+
+// Sellers with costs on [0, 1] asking halfway to 1.
+struct FirstPriceReverseCase {
+  using Env = FirstPriceReverse;
+  using Bid = Scatter;
+  static constexpr int kPlayers = 2;
+  static Env Make() { return Env(UniformValues(kPlayers, 0, 1)); }
+  static Bid MakeBid(int i) {
+    ArrayXd costs = ArrayXd::LinSpaced(101, 0, 1);
+    return {costs, (1 + costs) / 2 + Jitter(101, 0.01, i)};
+  }
+};
+
+// Two goods with values on [0, 1], bidding half of each value.
+struct FirstPrice2DCase {
+  using Env = FirstPrice2D;
+  using Bid = GridMulti;
+  static constexpr int kPlayers = 2;
+  static Env Make() {
+    return Env(UniformValues(kPlayers, 0, 1), UniformValues(kPlayers, 0, 1));
+  }
+  static Bid MakeBid(int i) {
+    ArrayXd values = ArrayXd::LinSpaced(11, 0, 1);
+    ArrayXXd x_mesh = GetXMesh(values, values.size());
+    ArrayXXd y_mesh = GetYMesh(values, values.size());
+    return {values,
+            values,
+            {x_mesh / 2 + Jitter(11, 11, 0.01, 2 * i),
+             y_mesh / 2 + Jitter(11, 11, 0.01, 2 * i + 1)}};
+  }
+};
+
+// The setting of common_value.cc: errors of +-500 and two draws per player.
+// Bids are relative to the midpoint of the draws, over their spread.
+template <class Auction>
+struct CommonValueSignalCase {
+  using Env = Auction;
+  using Bid = Scatter;
+  static constexpr int kPlayers = 2;
+  static Env Make() { return Env({2, 2}, 500, {-2000, 500}); }
+  static Bid MakeBid(int i) {
+    ArrayXd spreads = ArrayXd::LinSpaced(31, 0, 1000);
+    return {spreads, -spreads / 2 + Jitter(31, 10, i)};
+  }
+};
+
+// The setting of bidding_ga.cc: four bidders, values on [500, 9500] and
+// errors of +-500, bidding the signal less the error bound.
+template <class Auction>
+struct CommonValueEndpointsCase {
+  using Env = Auction;
+  using Bid = Scatter;
+  static constexpr int kPlayers = 4;
+  static Env Make() {
+    return Env(kPlayers, uniform_distribution<>(500, 9500),
+               uniform_distribution<>(-500, 500));
+  }
+  static Bid MakeBid(int i) {
+    ArrayXd signals = ArrayXd::LinSpaced(101, 0, 10000);
+    return {signals, signals - 500 + Jitter(101, 10, i)};
+  }
+};
+
+// The setting of common_value_full.cc with two draws per player.  Bids are
+// over the midpoint and spread of the draws.
+struct CommonValueSignalEndpointsCase {
+  using Env = CommonValueSignalEndpoints;
+  using Bid = Grid;
+  static constexpr int kPlayers = 2;
+  static Env Make() {
+    return Env(uniform_distribution<>(500, 9500),
+               uniform_distribution<>(-500, 500), {2, 2});
+  }
+  static Bid MakeBid(int i) {
+    ArrayXd midpoints = ArrayXd::LinSpaced(21, 0, 10000);
+    ArrayXd spreads = ArrayXd::LinSpaced(11, 0, 1000);
+    ArrayXXd bids = GetXMesh(midpoints, spreads.size()) -
+                    GetYMesh(spreads, midpoints.size()) / 2;
+    return {midpoints, spreads, bids + Jitter(11, 21, 10, i)};
+  }
+};
+
+template <class Env, class Bid, class = void>
+struct HasBatchFitness : std::false_type {};
+template <class Env, class Bid>
+struct HasBatchFitness<
+    Env, Bid,
+    std::void_t<decltype(std::declval<const Env&>().GetFitness(
+                             std::declval<const std::vector<Bid>&>(), 0)
+                             .size())>> : std::true_type {};
+
+// An environment holding every player's canonical strategy, precalculated.
+template <class Case>
+typename Case::Env MakeReady() {
+  auto env = Case::Make();
+  for (int id = 0; id < Case::kPlayers; ++id) {
+    env.AcceptStrategy(Case::MakeBid(id), id);
+  }
+  if constexpr (HasPrecalculate<typename Case::Env>::value) {
+    env.Precalculate();
+  }
+  return env;
+}
+
+template <class Case>
+void BM_Construct(benchmark::State& state) {
+  for (auto _ : state) {
+    auto env = Case::Make();
+    benchmark::DoNotOptimize(&env);
+  }
+}
+
+template <class Case>
+void BM_AcceptStrategy(benchmark::State& state) {
+  auto env = MakeReady<Case>();
+  auto bid = Case::MakeBid(Case::kPlayers);
+  for (auto _ : state) {
+    env.AcceptStrategy(bid, 0);
+    benchmark::ClobberMemory();
+  }
+}
+
+// The work a strategy change leaves for the next GetFitness.
+template <class Case>
+void BM_Precalculate(benchmark::State& state) {
+  auto env = MakeReady<Case>();
+  auto bid = Case::MakeBid(Case::kPlayers);
+  for (auto _ : state) {
+    state.PauseTiming();
+    env.AcceptStrategy(bid, 0);
+    state.ResumeTiming();
+    env.Precalculate();
+    benchmark::ClobberMemory();
+  }
+}
+
+template <class Case>
+void BM_GetFitness(benchmark::State& state) {
+  const auto env = MakeReady<Case>();
+  auto bid = Case::MakeBid(Case::kPlayers);
+  for (auto _ : state) {
+    float fitness = env.GetFitness(bid, 1);
+    benchmark::DoNotOptimize(fitness);
+  }
+}
+
+// kBatchSize bid functions at once, through the batch overload where the
+// environment has one.
+template <class Case>
+void BM_GetFitnessBatch(benchmark::State& state) {
+  using Env = typename Case::Env;
+  using Bid = typename Case::Bid;
+  const auto env = MakeReady<Case>();
+  std::vector<Bid> bids;
+  for (int i = 0; i < kBatchSize; ++i) {
+    bids.push_back(Case::MakeBid(Case::kPlayers + i));
+  }
+  for (auto _ : state) {
+    if constexpr (HasBatchFitness<Env, Bid>::value) {
+      auto fitnesses = env.GetFitness(bids, 1);
+      benchmark::DoNotOptimize(fitnesses.data());
+    } else {
+      for (const auto& bid : bids) {
+        float fitness = env.GetFitness(bid, 1);
+        benchmark::DoNotOptimize(fitness);
+      }
+    }
+  }
+  state.SetItemsProcessed(state.iterations() * kBatchSize);
+}
+
+template <class Case>
+bool RegisterCase(const std::string& name) {
+  benchmark::RegisterBenchmark((name + "/Construct").c_str(),
+                               BM_Construct<Case>)
+      ->Unit(benchmark::kMillisecond);
+  benchmark::RegisterBenchmark((name + "/AcceptStrategy").c_str(),
+                               BM_AcceptStrategy<Case>)
+      ->Unit(benchmark::kMicrosecond);
+  if constexpr (HasPrecalculate<typename Case::Env>::value) {
+    benchmark::RegisterBenchmark((name + "/Precalculate").c_str(),
+                                 BM_Precalculate<Case>)
+        ->Unit(benchmark::kMillisecond);
+  }
+  benchmark::RegisterBenchmark((name + "/GetFitness").c_str(),
+                               BM_GetFitness<Case>)
+      ->Unit(benchmark::kMicrosecond);
+  benchmark::RegisterBenchmark((name + "/GetFitnessBatch").c_str(),
+                               BM_GetFitnessBatch<Case>)
+      ->Unit(benchmark::kMillisecond);
+  return true;
+}
+
+[[maybe_unused]] const bool kRegistered =
+    RegisterCase<FirstPriceCase<2>>("FirstPrice") &&
+    RegisterCase<FirstPriceCase<kMaxProductFactors + 1>>("FirstPriceMany") &&
+    RegisterCase<SecondPriceCase>("SecondPrice") &&
+    RegisterCase<AllPayCase>("AllPay") &&
+    RegisterCase<FirstPriceReverseCase>("FirstPriceReverse") &&
+    RegisterCase<FirstPrice2DCase>("FirstPrice2D") &&
+    RegisterCase<CommonValueSignalCase<CommonValueSignal>>(
+        "CommonValueSignal") &&
+    RegisterCase<CommonValueSignalCase<CommonValueSignalSecond>>(
+        "CommonValueSignalSecond") &&
+    RegisterCase<CommonValueEndpointsCase<CommonValueEndpoints>>(
+        "CommonValueEndpoints") &&
+    RegisterCase<CommonValueEndpointsCase<CommonValueEndpoints2>>(
+        "CommonValueEndpoints2") &&
+    RegisterCase<CommonValueSignalEndpointsCase>(
+        "CommonValueSignalEndpoints");
+
+}  // namespace
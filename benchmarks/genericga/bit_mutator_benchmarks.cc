@@ -0,0 +1,51 @@
+#include <benchmark/benchmark.h>
+
+#include <vector>
+
+#include "genericga/binary/bit_mutator.h"
+#include "genericga/binary/byte_array_genotype.h"
+#include "genericga/random.h"
+
+namespace {
+
+using namespace genericga;
+using namespace genericga::binary;
+
+// Matches a default bidder: 10 composite components, each breeding 100
+// children of 11 floats at 32 bits.
+constexpr int kComponents = 10;
+constexpr int kChildren = 100;
+constexpr int kBytes = 11 * 32 / 8;
+constexpr float kExpBitMuts = 2;
+
+void MutateComponents(benchmark::State& state, bool geometric_skip) {
+  BitMutator mutator(kExpBitMuts, geometric_skip);
+  Philox4x32 stream = Philox4x32(1);
+  std::vector<std::vector<ByteArrayGenotype>> components(
+      kComponents,
+      std::vector<ByteArrayGenotype>(
+          kChildren, ByteArrayGenotype(std::vector<unsigned char>(kBytes))));
+  int generation = 0;
+  for (auto _ : state) {
+    for (auto& children : components) {
+      mutator.MutateAll(children, stream, generation);
+    }
+    ++generation;
+    benchmark::ClobberMemory();
+  }
+  state.SetItemsProcessed(state.iterations() * kComponents * kChildren);
+  state.SetBytesProcessed(state.iterations() * kComponents * kChildren *
+                          kBytes);
+}
+
+void BM_PerGenotype(benchmark::State& state) { MutateComponents(state, false); }
+BENCHMARK(BM_PerGenotype);
+
+void BM_GeometricSkip(benchmark::State& state) {
+  MutateComponents(state, true);
+}
+BENCHMARK(BM_GeometricSkip);
+
+}  // namespace
+
+BENCHMARK_MAIN();
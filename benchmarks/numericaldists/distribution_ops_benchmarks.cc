@@ -0,0 +1,64 @@
+#include <benchmark/benchmark.h>
+
+#include "numericaldists/distribution_ops.h"
+
+#include <eigen3/Eigen/Core>
+
+namespace {
+
+using namespace numericaldists;
+using Eigen::ArrayXd;
+using Eigen::ArrayXXd;
+
+// The CDF of a bid function b(v) = v^2 / 2 of uniform values on range(0)
+// points, as every auction's AcceptStrategy computes it.
+void BM_RandomVariableFunctionCDF(benchmark::State& state) {
+  int n = state.range(0);
+  ArrayXd xs = ArrayXd::LinSpaced(n, 0, 1);
+  ArrayXd pdf = ArrayXd::Ones(n);
+  ArrayXd bids = xs.square() / 2;
+  ArrayXd bid_range = ArrayXd::LinSpaced(n, 0, 0.5);
+  for (auto _ : state) {
+    ArrayXd cdf = RandomVariableFunctionCDF(xs, pdf, bids, bid_range);
+    benchmark::DoNotOptimize(cdf.data());
+  }
+  state.SetItemsProcessed(state.iterations() * n);
+}
+BENCHMARK(BM_RandomVariableFunctionCDF)
+    ->Arg(101)
+    ->Arg(1001)
+    ->Arg(10001)
+    ->Arg(100001);
+
+// The joint CDF of two functions of a uniform pair on a range(0) sided grid,
+// as in the two-dimensional auctions.  Sides stop at 1001.
+void BM_TwoRandomVariableFunctionCDF(benchmark::State& state) {
+  int n = state.range(0);
+  ArrayXd xs = ArrayXd::LinSpaced(n, 0, 1);
+  ArrayXXd joint_pdf = ArrayXXd::Ones(n, n);
+  ArrayXXd x_mesh = GetXMesh(xs, n);
+  ArrayXXd y_mesh = GetYMesh(xs, n);
+  ArrayXXd f1 = (x_mesh + y_mesh) / 2;
+  ArrayXXd f2 = x_mesh * y_mesh;
+  for (auto _ : state) {
+    ArrayXXd cdf =
+        TwoRandomVariableFunctionCDF(xs, xs, joint_pdf, f1, f2, xs, xs);
+    benchmark::DoNotOptimize(cdf.data());
+  }
+  state.SetItemsProcessed(state.iterations() * n * n);
+}
+BENCHMARK(BM_TwoRandomVariableFunctionCDF)->Arg(101)->Arg(301)->Arg(1001);
+
+void BM_PDF2D(benchmark::State& state) {
+  int n = state.range(0);
+  ArrayXd xs = ArrayXd::LinSpaced(n, 0, 1);
+  ArrayXXd cdf = GetXMesh(xs, n) * GetYMesh(xs, n);
+  for (auto _ : state) {
+    ArrayXXd pdf = PDF2D(xs, xs, cdf);
+    benchmark::DoNotOptimize(pdf.data());
+  }
+  state.SetItemsProcessed(state.iterations() * n * n);
+}
+BENCHMARK(BM_PDF2D)->Arg(101)->Arg(301)->Arg(1001);
+
+}  // namespace
@@ -0,0 +1,73 @@
+#include <benchmark/benchmark.h>
+
+#include "numericaldists/function_ops.h"
+
+#include <eigen3/Eigen/Core>
+
+namespace {
+
+using namespace numericaldists;
+using Eigen::ArrayXd;
+using Eigen::ArrayXXd;
+
+// 1D kernels sweep range(0) points from 101 to 100001.  2D kernels sweep the
+// side of a square grid from 101 to 1001; 100001 squared would not fit in
+// memory.
+void Sweep1D(benchmark::internal::Benchmark* bench) {
+  for (int n : {101, 1001, 10001, 100001}) {
+    bench->Arg(n);
+  }
+}
+
+void Sweep2D(benchmark::internal::Benchmark* bench) {
+  for (int n : {101, 301, 1001}) {
+    bench->Arg(n);
+  }
+}
+
+// A smooth surface on [0, 1]^2 with ys down the rows and xs across columns.
+ArrayXXd Surface(const ArrayXd& xs, const ArrayXd& ys) {
+  return (ys.matrix() * xs.matrix().transpose()).array().sqrt();
+}
+
+// Resamples a range(0) point function onto a grid of the same size shifted by
+// half a step, so every point lands between two knots.
+void BM_Interpolate(benchmark::State& state) {
+  int n = state.range(0);
+  ArrayXd xs = ArrayXd::LinSpaced(n, 0, 1);
+  ArrayXd ys = xs.sqrt();
+  ArrayXd new_xs = xs + 0.5 / (n - 1);
+  for (auto _ : state) {
+    ArrayXd new_ys = Interpolate(xs, ys, new_xs);
+    benchmark::DoNotOptimize(new_ys.data());
+  }
+  state.SetItemsProcessed(state.iterations() * n);
+}
+BENCHMARK(BM_Interpolate)->Apply(Sweep1D);
+
+void BM_Interpolate2D(benchmark::State& state) {
+  int n = state.range(0);
+  ArrayXd xs = ArrayXd::LinSpaced(n, 0, 1);
+  ArrayXXd zs = Surface(xs, xs);
+  ArrayXd new_xs = xs + 0.5 / (n - 1);
+  for (auto _ : state) {
+    ArrayXXd new_zs = Interpolate2D(xs, xs, zs, new_xs, new_xs);
+    benchmark::DoNotOptimize(new_zs.data());
+  }
+  state.SetItemsProcessed(state.iterations() * n * n);
+}
+BENCHMARK(BM_Interpolate2D)->Apply(Sweep2D);
+
+void BM_Areas2D(benchmark::State& state) {
+  int n = state.range(0);
+  ArrayXd xs = ArrayXd::LinSpaced(n, 0, 1);
+  ArrayXXd zs = Surface(xs, xs);
+  for (auto _ : state) {
+    ArrayXXd areas = Areas2D(xs, xs, zs);
+    benchmark::DoNotOptimize(areas.data());
+  }
+  state.SetItemsProcessed(state.iterations() * n * n);
+}
+BENCHMARK(BM_Areas2D)->Apply(Sweep2D);
+
+}  // namespace
@@ -0,0 +1,33 @@
+#include <benchmark/benchmark.h>
+
+#include <vector>
+
+#include "numericaldists/order_statistic_ops.h"
+
+#include <eigen3/Eigen/Core>
+
+namespace {
+
+using namespace numericaldists;
+using Eigen::ArrayXd;
+
+// The CDF of the second highest of range(1) players' bids, each with its own
+// CDF on range(0) points: the price in a second-price auction.
+void BM_KthLowestOrderStatisticCDF(benchmark::State& state) {
+  int n = state.range(0);
+  int n_players = state.range(1);
+  ArrayXd xs = ArrayXd::LinSpaced(n, 0, 1);
+  std::vector<ArrayXd> cdfs;
+  for (int i = 0; i < n_players; ++i) {
+    cdfs.push_back(xs.pow(1 + 0.25 * i));
+  }
+  for (auto _ : state) {
+    ArrayXd cdf = KthLowestOrderStatisticCDF(xs, cdfs, n_players - 1);
+    benchmark::DoNotOptimize(cdf.data());
+  }
+  state.SetItemsProcessed(state.iterations() * n);
+}
+BENCHMARK(BM_KthLowestOrderStatisticCDF)
+    ->ArgsProduct({{101, 1001, 10001, 100001}, {2, 4, 8}});
+
+}  // namespace
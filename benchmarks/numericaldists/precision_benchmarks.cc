@@ -0,0 +1,91 @@
+#include <benchmark/benchmark.h>
+
+#include <cmath>
+#include <vector>
+
+#include "auctions/first_price.h"
+#include "numericaldists/distribution.h"
+#include "numericaldists/kernels.h"
+#include "numericaldists/scatter.h"
+
+#include <boost/math/distributions/triangular.hpp>
+#include <eigen3/Eigen/Core>
+
+namespace {
+
+using namespace numericaldists;
+using Eigen::ArrayXd;
+
+// A bid function, an opponent CDF and a density, interpolated onto n_points
+// and integrated as their product, as the first-price fitness does.
+template <class Scalar>
+class KernelFitness {
+ public:
+  KernelFitness()
+      : bid_ys_(BidYs()),
+        cdf_((2 * ArrayX<Scalar>::LinSpaced(10001, 0, 1))
+                 .min(Scalar(1))
+                 .pow(Scalar(1.5))),
+        pdf_(Scalar(1.5) - ArrayX<Scalar>::LinSpaced(10001, 0, 1)) {}
+
+  Scalar operator()(int n_points) const {
+    ArrayX<Scalar> vals = ArrayX<Scalar>::LinSpaced(n_points, 0, 1);
+    ArrayX<Scalar> bids = InterpolateEven<Scalar>(0, 1, bid_ys_, vals);
+    ArrayX<Scalar> integrand = (vals - bids) *
+                               InterpolateEven<Scalar>(0, 1, cdf_, bids) *
+                               InterpolateEven<Scalar>(0, 1, pdf_, vals);
+    return TrapezoidIntegral<Scalar>(vals, integrand);
+  }
+
+ private:
+  static ArrayX<Scalar> BidYs() {
+    ArrayX<Scalar> vals = ArrayX<Scalar>::LinSpaced(101, 0, 1);
+    return (vals / 2).min(Scalar(0.35)) + Scalar(0.02) * (10 * vals).sin();
+  }
+
+  ArrayX<Scalar> bid_ys_;
+  ArrayX<Scalar> cdf_;
+  ArrayX<Scalar> pdf_;
+};
+
+// abs_delta is the difference from the double result at the same n_points.
+template <class Scalar>
+void BM_Kernels(benchmark::State& state) {
+  KernelFitness<Scalar> fitness;
+  int n_points = state.range(0);
+  Scalar value = 0;
+  for (auto _ : state) {
+    value = fitness(n_points);
+    benchmark::DoNotOptimize(value);
+  }
+  double reference = KernelFitness<double>()(n_points);
+  state.counters["abs_delta"] = std::abs(value - reference);
+  state.SetItemsProcessed(state.iterations() * n_points);
+}
+BENCHMARK_TEMPLATE(BM_Kernels, double)->RangeMultiplier(10)->Range(100, 100000);
+BENCHMARK_TEMPLATE(BM_Kernels, float)->RangeMultiplier(10)->Range(100, 100000);
+
+// FirstPrice::GetFitness on the grid path between two players with
+// triangular values, range(0) internal samples and a 101 point bid function.
+// rel_delta compares single precision scoring with double.
+void BM_FirstPriceFitness(benchmark::State& state) {
+  bool single = state.range(1);
+  std::vector<Distribution> dists(
+      2, boost::math::triangular_distribution<>(0, 0.5, 1));
+  auctions::FirstPrice auction(dists, state.range(0));
+  ArrayXd vals = ArrayXd::LinSpaced(101, 0, 1);
+  Scatter bids = {vals, (vals / 2).min(0.35) + 0.02 * (10 * vals).sin()};
+  auction.AcceptStrategy(bids, 0);
+  double reference = auction.GetFitness(bids, 1);
+  auction.SetSinglePrecision(single);
+  float fitness = 0;
+  for (auto _ : state) {
+    fitness = auction.GetFitness(bids, 1);
+    benchmark::DoNotOptimize(fitness);
+  }
+  state.counters["rel_delta"] = std::abs(fitness - reference) / reference;
+}
+BENCHMARK(BM_FirstPriceFitness)
+    ->ArgsProduct({{101, 1001, 10001, 100001}, {0, 1}});
+
+}  // namespace
@@ -0,0 +1,80 @@
+#include <benchmark/benchmark.h>
+
+#include <algorithm>
+#include <cmath>
+#include <functional>
+
+#include "numericaldists/function_ops.h"
+#include "numericaldists/quadrature.h"
+#include "numericaldists/scatter.h"
+
+#include <eigen3/Eigen/Core>
+
+namespace {
+
+using namespace numericaldists;
+using Eigen::ArrayXd;
+
+// A first-price fitness integrand: (v - b(v)) * F(b(v)) * f(v), where b is a
+// 101 point bid function with a kink, F a 10001 point opponent bid CDF and f
+// a value density, all piecewise linear as in the auctions.
+class FirstPriceIntegrand {
+ public:
+  FirstPriceIntegrand() {
+    ArrayXd vals = ArrayXd::LinSpaced(101, 0, 1);
+    bids_ = {vals, (vals / 2).min(0.35) + 0.02 * (10 * vals).sin()};
+    ArrayXd grid = ArrayXd::LinSpaced(10001, 0, 1);
+    cdf_ = {grid, (2 * grid).min(1.0).pow(1.5)};
+    pdf_ = {grid, 1.5 - grid};
+  }
+
+  ArrayXd operator()(const ArrayXd& vals) const {
+    ArrayXd bids = Interpolate(bids_, vals);
+    return (vals - bids) * Interpolate(cdf_, bids) * Interpolate(pdf_, vals);
+  }
+
+  double Reference() const {
+    return IntegrateAdaptive(*this, 0, 1, 1e-13, 100000).value;
+  }
+
+ private:
+  Scatter bids_;
+  Scatter cdf_;
+  Scatter pdf_;
+};
+
+// The fixed grid the auctions use: trapezoids on range(0) evenly spaced
+// points.
+void BM_Trapezoid(benchmark::State& state) {
+  FirstPriceIntegrand integrand;
+  double reference = integrand.Reference();
+  int n_points = state.range(0);
+  double value = 0;
+  for (auto _ : state) {
+    ArrayXd vals = ArrayXd::LinSpaced(n_points, 0, 1);
+    value = Areas(vals, integrand(vals)).sum();
+    benchmark::DoNotOptimize(value);
+  }
+  state.counters["evals"] = n_points;
+  state.counters["abs_error"] = std::abs(value - reference);
+}
+BENCHMARK(BM_Trapezoid)->Arg(34)->Arg(100)->Arg(300)->Arg(1000)->Arg(3000)->Arg(
+    10000);
+
+// Adaptive Gauss-Kronrod at tolerance 10^-range(0).
+void BM_Adaptive(benchmark::State& state) {
+  FirstPriceIntegrand integrand;
+  double reference = integrand.Reference();
+  double tolerance = std::pow(10.0, -state.range(0));
+  QuadratureResult result{};
+  for (auto _ : state) {
+    result = IntegrateAdaptive(std::cref(integrand), 0, 1, tolerance);
+    benchmark::DoNotOptimize(result.value);
+  }
+  state.counters["evals"] = result.n_evals;
+  state.counters["abs_error"] = std::abs(result.value - reference);
+  state.counters["est_error"] = result.error;
+}
+BENCHMARK(BM_Adaptive)->DenseRange(3, 9);
+
+}  // namespace
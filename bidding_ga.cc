@@ -9,6 +9,8 @@
 #include "auctions/first_price_reverse.h"
 #include "auctions/second_price.h"
 
+#include "biddingga/helpers.h"
+#include "biddingga/results.h"
 #include "genericga/binary/bit_mutator.h"
 #include "genericga/binary/byte_array_genotype.h"
 #include "genericga/binary/encoding.h"
@@ -30,6 +32,7 @@
 #include <algorithm>
 #include <eigen3/Eigen/Core>
 #include <iostream>
+#include <string>
 #include <vector>
 
 using namespace genericga;
@@ -63,7 +66,7 @@ SinglePopulationGA<binary::ByteArrayGenotype, Phen> BinaryGA(
   using Gen = binary::ByteArrayGenotype;
   int n_bytes = (n_bits + CHAR_BIT - 1) / CHAR_BIT;
   std::vector<Gen> genes;
-  auto generator = std::mt19937(std::random_device()());
+  auto generator = MakeStream();
   std::uniform_int_distribution<int> dist(0, UCHAR_MAX);
   for (int i = 0; i < pop_size; ++i) {
     std::vector<unsigned char> rand_gene(n_bytes);
@@ -242,53 +245,30 @@ void RunAndOutput(
     multipop::GA<Environment>& driver,
     std::vector<std::shared_ptr<multipop::SubGAAdapter<Environment, Phen>>>&
         gas,
-    Environment& env, int n_rounds, int output_frequency) {
-  for (int n = 0; n < n_rounds / output_frequency; ++n) {
-    driver.RunRound(output_frequency);
+    Environment& env, int n_rounds, biddingga::ResultsWriter& writer) {
+  int frequency = writer.GetSnapshotFrequency();
+  for (int n = 0; n < n_rounds / frequency; ++n) {
+    driver.RunRound(frequency);
+    biddingga::ResultsSnapshot snapshot;
+    snapshot.round = (n + 1) * frequency;
+    std::vector<Phen> best;
     for (int j = 0; j < gas.size(); ++j) {
-      ArrayXd xvals = gas[j]->GetBestStrategy().phenotype.xs.transpose();
-      for (int i = 0; i < xvals.size(); ++i) {
-        std::cout << xvals(i);
-        if (i != xvals.size() - 1) {
-          std::cout << ",";
-        }
-      }
-      std::cout << std::endl;
-      ArrayXd vals = gas[j]->GetBestStrategy().phenotype.ys.transpose();
-      for (int i = 0; i < vals.size(); ++i) {
-        std::cout << vals(i);
-        if (i != vals.size() - 1) {
-          std::cout << ",";
-        }
-      }
-      std::cout << std::endl;
-      env.AcceptStrategy(gas[j]->GetBestStrategy().phenotype, j);
+      best.push_back(gas[j]->GetBestStrategy().phenotype);
+      snapshot.Add("x_" + std::to_string(j), best[j].xs);
+      snapshot.Add("y_" + std::to_string(j), best[j].ys);
+      env.AcceptStrategy(best[j], j);
     }
+    std::vector<float> fitnesses;
     for (int j = 0; j < gas.size(); ++j) {
-      std::cout << env.GetFitness(gas[j]->GetBestStrategy().phenotype, j);
-      if (j != gas.size() - 1) {
-        std::cout << ",";
-      }
+      fitnesses.push_back(env.GetFitness(best[j], j));
     }
-    std::cout << std::endl;
-    // for (int j = 0; j < gas.size(); ++j) {
-    //   std::cout << env.GetRevenue(gas[j]->GetBestStrategy().phenotype, j);
-    //   if (j != gas.size() - 1) {
-    //     std::cout << ",";
-    //   }
-    // }
-    // std::cout << std::endl;
-    // for (int j = 0; j < gas.size(); ++j) {
-    //   std::cout << env.GetValue(gas[j]->GetBestStrategy().phenotype, j);
-    //   if (j != gas.size() - 1) {
-    //     std::cout << ",";
-    //   }
-    // }
-    // std::cout << std::endl;
+    snapshot.Add("fitness", std::move(fitnesses));
+    writer.Write(std::move(snapshot));
   }
 }
 
 int main(int argc, char** argv) {
+  std::uint64_t seed = biddingga::SeedFromArgs(&argc, argv);
   // std::vector<Distribution> dists{
   //       uniform_distribution<>(0, 1),
   //       uniform_distribution<>(0, 1)};
@@ -323,9 +303,21 @@ int main(int argc, char** argv) {
   // Auction auction(n_players, value_dist, error_dist);
   auto gas = MakeSubGAs<Auction, Scatter>(configs);
   auto driver = MakeMultipopDriver<Auction, Scatter>(gas, auction);
+  // biddingga [results_file] [seed=<n>]; results_to_csv prints the file as
+  // CSV.  The run seed is kept in the file's header.
   int n_rounds = 1000;
   int output_frequency = 10;
-  RunAndOutput(driver, gas, auction, n_rounds, output_frequency);
+  std::string path = argc > 1 ? argv[1] : "biddingga.results";
+  biddingga::ResultsWriter writer(path, output_frequency, seed);
+  if (!writer.IsOpen()) {
+    std::cerr << "Cannot open results file " << path << std::endl;
+    return 1;
+  }
+  RunAndOutput(driver, gas, auction, n_rounds, writer);
+  if (!writer.Flush()) {
+    std::cerr << "Cannot write results file " << path << std::endl;
+    return 1;
+  }
 
   return 0;
 }
@@ -1,9 +1,13 @@
+#include <fstream>
+#include <iostream>
+
 #include <boost/math/distributions/exponential.hpp>
 #include <boost/math/distributions/normal.hpp>
 #include <boost/math/distributions/uniform.hpp>
 
 #include "auctions/first_price_2d.h"
 
+#include "biddingga/helpers.h"
 #include "genericga/binary/bit_mutator.h"
 #include "genericga/binary/byte_array_genotype.h"
 #include "genericga/binary/encoding.h"
@@ -18,6 +22,7 @@
 #include "genericga/selector/tournament_mixed.h"
 #include "genericga/selector/tournament_poisson.h"
 #include "genericga/single_population_ga.h"
+#include "genericga/trace.h"
 
 #include "numericaldists/distribution.h"
 #include "numericaldists/grid_multi.h"
@@ -58,7 +63,7 @@ SinglePopulationGA<binary::ByteArrayGenotype, Phen> BinaryGA(
   using Gen = binary::ByteArrayGenotype;
   int n_bytes = (n_bits + CHAR_BIT - 1) / CHAR_BIT;
   std::vector<Gen> genes;
-  auto generator = std::mt19937(std::random_device()());
+  auto generator = MakeStream();
   std::uniform_int_distribution<int> dist(0, UCHAR_MAX);
   for (int i = 0; i < pop_size; ++i) {
     std::vector<unsigned char> rand_gene(n_bytes);
@@ -491,6 +496,7 @@ void RunAndOutput(
 }
 
 int main(int argc, char** argv) {
+  std::uint64_t seed = biddingga::SeedFromArgs(&argc, argv);
   std::vector<Distribution> dists{
       uniform_distribution<>(0, 1), uniform_distribution<>(0, 1),
       uniform_distribution<>(0, 1), uniform_distribution<>(0, 1)};
@@ -519,9 +525,28 @@ int main(int argc, char** argv) {
   auto gas = MakeSubGAs<FirstPrice2D, GridMulti>(configs);
   auto driver = MakeMultipopDriver<FirstPrice2D, GridMulti>(gas, auction);
 
+  // An optional argument names a file for a Chrome trace of the run, which
+  // is only recorded in GENERICGA_PROFILE builds.  seed=<n> sets the run seed.
+  TraceSink trace;
+  bool write_trace = argc > 1 && kProfileEnabled;
+  if (argc > 1 && !kProfileEnabled) {
+    std::cerr << "Not writing " << argv[1]
+              << ": tracing needs a GENERICGA_PROFILE build" << std::endl;
+  }
+  if (write_trace) {
+    SetTraceSink(&trace);
+  }
+
   int n_rounds = 3000;
   int output_frequency = 30;
+  std::cout << "seed," << seed << std::endl;
   RunAndOutput(driver, gas, auction, n_rounds, output_frequency);
 
+  if (write_trace) {
+    SetTraceSink(nullptr);
+    std::ofstream trace_file(argv[1]);
+    trace.WriteJSON(trace_file);
+  }
+
   return 0;
 }
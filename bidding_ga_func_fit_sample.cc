@@ -36,7 +36,7 @@ std::vector<binary::ByteArrayGenotype> RandomBinaryStrategies(int pop_size,
                                                               int n_bits) {
   int n_bytes = (n_bits + CHAR_BIT - 1) / CHAR_BIT;
   std::vector<binary::ByteArrayGenotype> genes;
-  auto generator = std::mt19937(std::random_device()());
+  auto generator = MakeStream();
   std::uniform_int_distribution<int> dist(0, UCHAR_MAX);
   for (int i = 0; i < pop_size; ++i) {
     std::vector<unsigned char> rand_gene(n_bytes);
@@ -3,10 +3,13 @@
 #include <boost/math/distributions/uniform.hpp>
 
 #include "auctions/all_pay.h"
+#include "auctions/best_response.h"
 #include "auctions/first_price.h"
 #include "auctions/second_price.h"
 
+#include "biddingga/helpers.h"
 #include "genericga/composite_ga.h"
+#include "genericga/local_search.h"
 #include "genericga/multipop/ga.h"
 #include "genericga/multipop/sub_ga_adapter.h"
 #include "genericga/real/modify_mutation.h"
@@ -20,6 +23,9 @@
 #include "numericaldists/distribution.h"
 
 #include <eigen3/Eigen/Core>
+#include <cstdlib>
+#include <iostream>
+#include <vector>
 
 using namespace genericga;
 using namespace auctions;
@@ -36,6 +42,8 @@ struct BidFunctionGAConfiguration {
   int n_strategies = 50;
   int n_children = 50;
   int n_segments = 30;
+  // Rounds between local searches from each population's best, 0 for none.
+  int local_search_frequency = 0;
 };
 
 template <class Phen>
@@ -47,7 +55,7 @@ SinglePopulationGA<Gen, Phen> GA1DFunc(
           return std::vector<float>(phens.size(), -1.0);
         }) {
   std::vector<Gen> genes;
-  auto generator = std::mt19937(std::random_device()());
+  auto generator = MakeStream();
   std::uniform_real_distribution<> dist(min, max);
   for (int i = 0; i < pop_size; ++i) {
     std::vector<double> rand_gene(n_segments + 1);
@@ -136,9 +144,15 @@ std::unique_ptr<CompositeGA<Phen>> MakeGAComposite(
   for (int i = 0; i < config.n_segments; ++i) {
     ArrayXd sub_vals = vals.segment(i, 2);
     VecToPiecewise conversion(VecToPiecewise{sub_vals});
-    gas.push_back(std::make_shared<SinglePopulationGA<Gen, Phen>>(
+    auto ga = std::make_shared<SinglePopulationGA<Gen, Phen>>(
         GA1DFunc<Phen>(conversion, config.n_strategies, 1, config.bid_range.min,
-                       config.bid_range.max)));
+                       config.bid_range.max));
+    if (config.local_search_frequency > 0) {
+      ga->SetLocalSearch(CoordinateSearch(Gen(gene_size, config.bid_range.min),
+                                          Gen(gene_size, config.bid_range.max)),
+                         config.local_search_frequency);
+    }
+    gas.push_back(std::move(ga));
   }
   return std::make_unique<CompositeGA<Phen>>(gas, MedianJoiner);
 }
@@ -168,7 +182,7 @@ multipop::GA<Environment> MakeMultipopDriver(
   return multipop::GA<Environment>(sub_gas, env, 10, 200);
 }
 
-void RunWinnerPay() {
+void RunWinnerPay(int local_search_frequency) {
   std::vector<Distribution> dists{uniform_distribution<>(0, 1),
                                   uniform_distribution<>(0, 1),
                                   uniform_distribution<>(0, 1)};
@@ -182,12 +196,19 @@ void RunWinnerPay() {
     config.n_strategies = 20;
     config.n_children = 20;
     config.n_segments = 100;
+    config.local_search_frequency = local_search_frequency;
     configs.push_back(std::move(config));
   }
   int n_rounds = 1000;
   AllPay auction(dists);
   auto gas = MakeSubGAs<AllPay, Phen>(std::move(configs));
   auto driver = MakeMultipopDriver<AllPay, Phen>(gas, auction);
+  // Stops once the bid functions have settled for 20 rounds and no player
+  // could gain more than 1e-3 by switching to a best response.
+  multipop::ConvergenceCriteria criteria{0.01, 1e-3, 20};
+  criteria.best_response_gap = MakeBestResponseGap(auction, gas);
+  criteria.gap_tolerance = 1e-3;
+  driver.SetConvergenceCriteria(std::move(criteria));
   ArrayXd vals = gas[0]->GetBestStrategy().phenotype.xs.transpose();
   for (int n = 0; n < n_rounds; ++n) {
     driver.RunRound(1);
@@ -203,10 +224,29 @@ void RunWinnerPay() {
       }
       std::cout << std::endl;
     }
+    if ((n + 1) % 100 == 0) {
+      std::vector<Phen> best;
+      for (const auto& ga : gas) {
+        best.push_back(ga->GetBestStrategy().phenotype);
+      }
+      auto report = GetEquilibriumReport(auction, best);
+      std::cerr << "round " << n + 1 << ": epsilon " << report.epsilon
+                << std::endl;
+    }
+    if (driver.HasConverged()) {
+      std::cerr << "converged after " << n + 1 << " rounds" << std::endl;
+      break;
+    }
   }
 }
 
+// biddingga_real [seed=<n>] [local_search_rounds]
+// With local_search_rounds, each population runs a coordinate search from its
+// best strategy that often.
 int main(int argc, char** argv) {
-  RunWinnerPay();
+  std::uint64_t seed = biddingga::SeedFromArgs(&argc, argv);
+  int local_search_frequency = argc > 1 ? std::atoi(argv[1]) : 0;
+  std::cout << "seed," << seed << std::endl;
+  RunWinnerPay(local_search_frequency);
   return 0;
 }
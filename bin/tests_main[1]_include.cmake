@@ -0,0 +1,5 @@
+if(EXISTS "/root/repo/bin/tests_main[1]_tests.cmake")
+  include("/root/repo/bin/tests_main[1]_tests.cmake")
+else()
+  add_test(tests_main_NOT_BUILT tests_main_NOT_BUILT)
+endif()
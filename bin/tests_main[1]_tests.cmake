@@ -0,0 +1,221 @@
+add_test([=[FirstPriceTest.AlwaysWinTest]=]  /root/repo/bin/tests_main [==[--gtest_filter=FirstPriceTest.AlwaysWinTest]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[FirstPriceTest.AlwaysWinTest]=]  PROPERTIES WORKING_DIRECTORY /root/repo/bin SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[FirstPriceTest.WinHalfTest]=]  /root/repo/bin/tests_main [==[--gtest_filter=FirstPriceTest.WinHalfTest]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[FirstPriceTest.WinHalfTest]=]  PROPERTIES WORKING_DIRECTORY /root/repo/bin SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[FirstPriceTest.DecreasingBidsTest]=]  /root/repo/bin/tests_main [==[--gtest_filter=FirstPriceTest.DecreasingBidsTest]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[FirstPriceTest.DecreasingBidsTest]=]  PROPERTIES WORKING_DIRECTORY /root/repo/bin SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[FirstPriceTest.DecreasingBids2Test]=]  /root/repo/bin/tests_main [==[--gtest_filter=FirstPriceTest.DecreasingBids2Test]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[FirstPriceTest.DecreasingBids2Test]=]  PROPERTIES WORKING_DIRECTORY /root/repo/bin SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[FirstPriceTest.NoIntersectDistsTest]=]  /root/repo/bin/tests_main [==[--gtest_filter=FirstPriceTest.NoIntersectDistsTest]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[FirstPriceTest.NoIntersectDistsTest]=]  PROPERTIES WORKING_DIRECTORY /root/repo/bin SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[FirstPriceTest.BidSegmentTest]=]  /root/repo/bin/tests_main [==[--gtest_filter=FirstPriceTest.BidSegmentTest]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[FirstPriceTest.BidSegmentTest]=]  PROPERTIES WORKING_DIRECTORY /root/repo/bin SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[FirstPriceTest.ExactFitnessTest]=]  /root/repo/bin/tests_main [==[--gtest_filter=FirstPriceTest.ExactFitnessTest]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[FirstPriceTest.ExactFitnessTest]=]  PROPERTIES WORKING_DIRECTORY /root/repo/bin SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[FirstPriceTest.UtilityTest]=]  /root/repo/bin/tests_main [==[--gtest_filter=FirstPriceTest.UtilityTest]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[FirstPriceTest.UtilityTest]=]  PROPERTIES WORKING_DIRECTORY /root/repo/bin SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[FirstPriceTest.SinglePrecisionTest]=]  /root/repo/bin/tests_main [==[--gtest_filter=FirstPriceTest.SinglePrecisionTest]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[FirstPriceTest.SinglePrecisionTest]=]  PROPERTIES WORKING_DIRECTORY /root/repo/bin SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[FirstPriceTest.MixTest]=]  /root/repo/bin/tests_main [==[--gtest_filter=FirstPriceTest.MixTest]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[FirstPriceTest.MixTest]=]  PROPERTIES WORKING_DIRECTORY /root/repo/bin SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[BestResponseTest.FirstPriceTest]=]  /root/repo/bin/tests_main [==[--gtest_filter=BestResponseTest.FirstPriceTest]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[BestResponseTest.FirstPriceTest]=]  PROPERTIES WORKING_DIRECTORY /root/repo/bin SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[BestResponseTest.AllPayTest]=]  /root/repo/bin/tests_main [==[--gtest_filter=BestResponseTest.AllPayTest]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[BestResponseTest.AllPayTest]=]  PROPERTIES WORKING_DIRECTORY /root/repo/bin SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[BestResponseTest.SecondPriceTest]=]  /root/repo/bin/tests_main [==[--gtest_filter=BestResponseTest.SecondPriceTest]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[BestResponseTest.SecondPriceTest]=]  PROPERTIES WORKING_DIRECTORY /root/repo/bin SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[BestResponseTest.EquilibriumReportTest]=]  /root/repo/bin/tests_main [==[--gtest_filter=BestResponseTest.EquilibriumReportTest]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[BestResponseTest.EquilibriumReportTest]=]  PROPERTIES WORKING_DIRECTORY /root/repo/bin SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[BestResponseTest.BestResponseGapTest]=]  /root/repo/bin/tests_main [==[--gtest_filter=BestResponseTest.BestResponseGapTest]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[BestResponseTest.BestResponseGapTest]=]  PROPERTIES WORKING_DIRECTORY /root/repo/bin SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[SignalValueDistTest.CachedMatchesUncachedTest]=]  /root/repo/bin/tests_main [==[--gtest_filter=SignalValueDistTest.CachedMatchesUncachedTest]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[SignalValueDistTest.CachedMatchesUncachedTest]=]  PROPERTIES WORKING_DIRECTORY /root/repo/bin SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[SignalValueDistTest.ConcurrentFirstUseTest]=]  /root/repo/bin/tests_main [==[--gtest_filter=SignalValueDistTest.ConcurrentFirstUseTest]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[SignalValueDistTest.ConcurrentFirstUseTest]=]  PROPERTIES WORKING_DIRECTORY /root/repo/bin SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[SignalValueDistTest.ReleasedTablesAreFreedTest]=]  /root/repo/bin/tests_main [==[--gtest_filter=SignalValueDistTest.ReleasedTablesAreFreedTest]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[SignalValueDistTest.ReleasedTablesAreFreedTest]=]  PROPERTIES WORKING_DIRECTORY /root/repo/bin SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[SignalValueDistTest.LoadedStrategiesTest]=]  /root/repo/bin/tests_main [==[--gtest_filter=SignalValueDistTest.LoadedStrategiesTest]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[SignalValueDistTest.LoadedStrategiesTest]=]  PROPERTIES WORKING_DIRECTORY /root/repo/bin SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[ResultsTest.RoundTripTest]=]  /root/repo/bin/tests_main [==[--gtest_filter=ResultsTest.RoundTripTest]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[ResultsTest.RoundTripTest]=]  PROPERTIES WORKING_DIRECTORY /root/repo/bin SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[ResultsTest.UnseededHeaderTest]=]  /root/repo/bin/tests_main [==[--gtest_filter=ResultsTest.UnseededHeaderTest]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[ResultsTest.UnseededHeaderTest]=]  PROPERTIES WORKING_DIRECTORY /root/repo/bin SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[ResultsTest.CSVTest]=]  /root/repo/bin/tests_main [==[--gtest_filter=ResultsTest.CSVTest]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[ResultsTest.CSVTest]=]  PROPERTIES WORKING_DIRECTORY /root/repo/bin SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[ResultsTest.WriterTest]=]  /root/repo/bin/tests_main [==[--gtest_filter=ResultsTest.WriterTest]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[ResultsTest.WriterTest]=]  PROPERTIES WORKING_DIRECTORY /root/repo/bin SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[ResultsTest.UnwritableTest]=]  /root/repo/bin/tests_main [==[--gtest_filter=ResultsTest.UnwritableTest]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[ResultsTest.UnwritableTest]=]  PROPERTIES WORKING_DIRECTORY /root/repo/bin SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[ResultsTest.ResumeTest]=]  /root/repo/bin/tests_main [==[--gtest_filter=ResultsTest.ResumeTest]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[ResultsTest.ResumeTest]=]  PROPERTIES WORKING_DIRECTORY /root/repo/bin SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[DistributionTest.UniformTest]=]  /root/repo/bin/tests_main [==[--gtest_filter=DistributionTest.UniformTest]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[DistributionTest.UniformTest]=]  PROPERTIES WORKING_DIRECTORY /root/repo/bin SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[DistributionTest.NormalTest]=]  /root/repo/bin/tests_main [==[--gtest_filter=DistributionTest.NormalTest]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[DistributionTest.NormalTest]=]  PROPERTIES WORKING_DIRECTORY /root/repo/bin SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[DistributionTest.ExponentialTest]=]  /root/repo/bin/tests_main [==[--gtest_filter=DistributionTest.ExponentialTest]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[DistributionTest.ExponentialTest]=]  PROPERTIES WORKING_DIRECTORY /root/repo/bin SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[DistributionTest.GenericTest]=]  /root/repo/bin/tests_main [==[--gtest_filter=DistributionTest.GenericTest]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[DistributionTest.GenericTest]=]  PROPERTIES WORKING_DIRECTORY /root/repo/bin SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[DistributionOpsTest.CDF2DTest]=]  /root/repo/bin/tests_main [==[--gtest_filter=DistributionOpsTest.CDF2DTest]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[DistributionOpsTest.CDF2DTest]=]  PROPERTIES WORKING_DIRECTORY /root/repo/bin SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[DistributionOpsTest.PDF2DTest]=]  /root/repo/bin/tests_main [==[--gtest_filter=DistributionOpsTest.PDF2DTest]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[DistributionOpsTest.PDF2DTest]=]  PROPERTIES WORKING_DIRECTORY /root/repo/bin SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[DistributionOpsTest.ExpectedValueFunctionPDFTest]=]  /root/repo/bin/tests_main [==[--gtest_filter=DistributionOpsTest.ExpectedValueFunctionPDFTest]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[DistributionOpsTest.ExpectedValueFunctionPDFTest]=]  PROPERTIES WORKING_DIRECTORY /root/repo/bin SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[DistributionOpsTest.CDFExpectedValueFunctionTest]=]  /root/repo/bin/tests_main [==[--gtest_filter=DistributionOpsTest.CDFExpectedValueFunctionTest]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[DistributionOpsTest.CDFExpectedValueFunctionTest]=]  PROPERTIES WORKING_DIRECTORY /root/repo/bin SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[DistributionOpsTest.RandomVariableFunctionCDFTest]=]  /root/repo/bin/tests_main [==[--gtest_filter=DistributionOpsTest.RandomVariableFunctionCDFTest]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[DistributionOpsTest.RandomVariableFunctionCDFTest]=]  PROPERTIES WORKING_DIRECTORY /root/repo/bin SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[FunctionOpsTest.InterpolateTest]=]  /root/repo/bin/tests_main [==[--gtest_filter=FunctionOpsTest.InterpolateTest]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[FunctionOpsTest.InterpolateTest]=]  PROPERTIES WORKING_DIRECTORY /root/repo/bin SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[FunctionOpsTest.InterpolateUnevenTest]=]  /root/repo/bin/tests_main [==[--gtest_filter=FunctionOpsTest.InterpolateUnevenTest]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[FunctionOpsTest.InterpolateUnevenTest]=]  PROPERTIES WORKING_DIRECTORY /root/repo/bin SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[FunctionOpsTest.Interpolote2DTest]=]  /root/repo/bin/tests_main [==[--gtest_filter=FunctionOpsTest.Interpolote2DTest]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[FunctionOpsTest.Interpolote2DTest]=]  PROPERTIES WORKING_DIRECTORY /root/repo/bin SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[FunctionOpsTest.InterpoloteUneven2DTest]=]  /root/repo/bin/tests_main [==[--gtest_filter=FunctionOpsTest.InterpoloteUneven2DTest]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[FunctionOpsTest.InterpoloteUneven2DTest]=]  PROPERTIES WORKING_DIRECTORY /root/repo/bin SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[FunctionOpsTest.InverseUnevenTest]=]  /root/repo/bin/tests_main [==[--gtest_filter=FunctionOpsTest.InverseUnevenTest]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[FunctionOpsTest.InverseUnevenTest]=]  PROPERTIES WORKING_DIRECTORY /root/repo/bin SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[FunctionOpsTest.InverseUnevenVerticalTest]=]  /root/repo/bin/tests_main [==[--gtest_filter=FunctionOpsTest.InverseUnevenVerticalTest]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[FunctionOpsTest.InverseUnevenVerticalTest]=]  PROPERTIES WORKING_DIRECTORY /root/repo/bin SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[FunctionOpsTest.InverseHorizontalFunctionTest]=]  /root/repo/bin/tests_main [==[--gtest_filter=FunctionOpsTest.InverseHorizontalFunctionTest]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[FunctionOpsTest.InverseHorizontalFunctionTest]=]  PROPERTIES WORKING_DIRECTORY /root/repo/bin SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[FunctionOpsTest.InverseDecreasingFunctionTest]=]  /root/repo/bin/tests_main [==[--gtest_filter=FunctionOpsTest.InverseDecreasingFunctionTest]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[FunctionOpsTest.InverseDecreasingFunctionTest]=]  PROPERTIES WORKING_DIRECTORY /root/repo/bin SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[FunctionOpsTest.DerivativeTest]=]  /root/repo/bin/tests_main [==[--gtest_filter=FunctionOpsTest.DerivativeTest]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[FunctionOpsTest.DerivativeTest]=]  PROPERTIES WORKING_DIRECTORY /root/repo/bin SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[FunctionOpsTest.AreasTest]=]  /root/repo/bin/tests_main [==[--gtest_filter=FunctionOpsTest.AreasTest]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[FunctionOpsTest.AreasTest]=]  PROPERTIES WORKING_DIRECTORY /root/repo/bin SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[FunctionOpsTest.Areas2DTest]=]  /root/repo/bin/tests_main [==[--gtest_filter=FunctionOpsTest.Areas2DTest]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[FunctionOpsTest.Areas2DTest]=]  PROPERTIES WORKING_DIRECTORY /root/repo/bin SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[FunctionOpsTest.IntegralBelowTest]=]  /root/repo/bin/tests_main [==[--gtest_filter=FunctionOpsTest.IntegralBelowTest]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[FunctionOpsTest.IntegralBelowTest]=]  PROPERTIES WORKING_DIRECTORY /root/repo/bin SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[FunctionOpsTest.IntegralBelow2DTest]=]  /root/repo/bin/tests_main [==[--gtest_filter=FunctionOpsTest.IntegralBelow2DTest]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[FunctionOpsTest.IntegralBelow2DTest]=]  PROPERTIES WORKING_DIRECTORY /root/repo/bin SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[FunctionOpsTest.IntegralAboveTest]=]  /root/repo/bin/tests_main [==[--gtest_filter=FunctionOpsTest.IntegralAboveTest]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[FunctionOpsTest.IntegralAboveTest]=]  PROPERTIES WORKING_DIRECTORY /root/repo/bin SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[OrderStatisticOpsTest.LowestSingleDistOrderStatisticTest]=]  /root/repo/bin/tests_main [==[--gtest_filter=OrderStatisticOpsTest.LowestSingleDistOrderStatisticTest]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[OrderStatisticOpsTest.LowestSingleDistOrderStatisticTest]=]  PROPERTIES WORKING_DIRECTORY /root/repo/bin SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[OrderStatisticOpsTest.MiddleSingleDistOrderStatisticTest]=]  /root/repo/bin/tests_main [==[--gtest_filter=OrderStatisticOpsTest.MiddleSingleDistOrderStatisticTest]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[OrderStatisticOpsTest.MiddleSingleDistOrderStatisticTest]=]  PROPERTIES WORKING_DIRECTORY /root/repo/bin SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[OrderStatisticOpsTest.HighestSingleDistOrderStatisticTest]=]  /root/repo/bin/tests_main [==[--gtest_filter=OrderStatisticOpsTest.HighestSingleDistOrderStatisticTest]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[OrderStatisticOpsTest.HighestSingleDistOrderStatisticTest]=]  PROPERTIES WORKING_DIRECTORY /root/repo/bin SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[OrderStatisticOpsTest.LowestMultiDistOrderStatisticTest]=]  /root/repo/bin/tests_main [==[--gtest_filter=OrderStatisticOpsTest.LowestMultiDistOrderStatisticTest]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[OrderStatisticOpsTest.LowestMultiDistOrderStatisticTest]=]  PROPERTIES WORKING_DIRECTORY /root/repo/bin SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[OrderStatisticOpsTest.MiddleMultiDistOrderStatisticTest]=]  /root/repo/bin/tests_main [==[--gtest_filter=OrderStatisticOpsTest.MiddleMultiDistOrderStatisticTest]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[OrderStatisticOpsTest.MiddleMultiDistOrderStatisticTest]=]  PROPERTIES WORKING_DIRECTORY /root/repo/bin SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[OrderStatisticOpsTest.HighestMultiDistOrderStatisticTest]=]  /root/repo/bin/tests_main [==[--gtest_filter=OrderStatisticOpsTest.HighestMultiDistOrderStatisticTest]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[OrderStatisticOpsTest.HighestMultiDistOrderStatisticTest]=]  PROPERTIES WORKING_DIRECTORY /root/repo/bin SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[IntervalTest.InIntervalTest]=]  /root/repo/bin/tests_main [==[--gtest_filter=IntervalTest.InIntervalTest]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[IntervalTest.InIntervalTest]=]  PROPERTIES WORKING_DIRECTORY /root/repo/bin SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[CombinationGenerationTest.GenerateFirstsTest]=]  /root/repo/bin/tests_main [==[--gtest_filter=CombinationGenerationTest.GenerateFirstsTest]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[CombinationGenerationTest.GenerateFirstsTest]=]  PROPERTIES WORKING_DIRECTORY /root/repo/bin SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[CombinationGenerationTest.GetNextTest]=]  /root/repo/bin/tests_main [==[--gtest_filter=CombinationGenerationTest.GetNextTest]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[CombinationGenerationTest.GetNextTest]=]  PROPERTIES WORKING_DIRECTORY /root/repo/bin SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[QuadratureTest.PolynomialTest]=]  /root/repo/bin/tests_main [==[--gtest_filter=QuadratureTest.PolynomialTest]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[QuadratureTest.PolynomialTest]=]  PROPERTIES WORKING_DIRECTORY /root/repo/bin SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[QuadratureTest.KinkTest]=]  /root/repo/bin/tests_main [==[--gtest_filter=QuadratureTest.KinkTest]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[QuadratureTest.KinkTest]=]  PROPERTIES WORKING_DIRECTORY /root/repo/bin SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[QuadratureTest.MaxIntervalsTest]=]  /root/repo/bin/tests_main [==[--gtest_filter=QuadratureTest.MaxIntervalsTest]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[QuadratureTest.MaxIntervalsTest]=]  PROPERTIES WORKING_DIRECTORY /root/repo/bin SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[PiecewiseLinearTest.EvaluateTest]=]  /root/repo/bin/tests_main [==[--gtest_filter=PiecewiseLinearTest.EvaluateTest]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[PiecewiseLinearTest.EvaluateTest]=]  PROPERTIES WORKING_DIRECTORY /root/repo/bin SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[PiecewiseLinearTest.SimplifiedTest]=]  /root/repo/bin/tests_main [==[--gtest_filter=PiecewiseLinearTest.SimplifiedTest]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[PiecewiseLinearTest.SimplifiedTest]=]  PROPERTIES WORKING_DIRECTORY /root/repo/bin SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[PiecewiseLinearTest.IntegrateProductTest]=]  /root/repo/bin/tests_main [==[--gtest_filter=PiecewiseLinearTest.IntegrateProductTest]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[PiecewiseLinearTest.IntegrateProductTest]=]  PROPERTIES WORKING_DIRECTORY /root/repo/bin SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[PiecewiseLinearTest.UniformImageCDFTest]=]  /root/repo/bin/tests_main [==[--gtest_filter=PiecewiseLinearTest.UniformImageCDFTest]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[PiecewiseLinearTest.UniformImageCDFTest]=]  PROPERTIES WORKING_DIRECTORY /root/repo/bin SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[PiecewiseLinearTest.ComposeTest]=]  /root/repo/bin/tests_main [==[--gtest_filter=PiecewiseLinearTest.ComposeTest]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[PiecewiseLinearTest.ComposeTest]=]  PROPERTIES WORKING_DIRECTORY /root/repo/bin SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[PiecewiseLinearTest.ComposeEachTest]=]  /root/repo/bin/tests_main [==[--gtest_filter=PiecewiseLinearTest.ComposeEachTest]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[PiecewiseLinearTest.ComposeEachTest]=]  PROPERTIES WORKING_DIRECTORY /root/repo/bin SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[AliasSamplerTest.MatchesWeightsTest]=]  /root/repo/bin/tests_main [==[--gtest_filter=AliasSamplerTest.MatchesWeightsTest]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[AliasSamplerTest.MatchesWeightsTest]=]  PROPERTIES WORKING_DIRECTORY /root/repo/bin SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[AliasSamplerTest.ResetTest]=]  /root/repo/bin/tests_main [==[--gtest_filter=AliasSamplerTest.ResetTest]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[AliasSamplerTest.ResetTest]=]  PROPERTIES WORKING_DIRECTORY /root/repo/bin SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[AliasSamplerTest.AllZeroUniformTest]=]  /root/repo/bin/tests_main [==[--gtest_filter=AliasSamplerTest.AllZeroUniformTest]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[AliasSamplerTest.AllZeroUniformTest]=]  PROPERTIES WORKING_DIRECTORY /root/repo/bin SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[VectorOpsTest.OrderingsTest]=]  /root/repo/bin/tests_main [==[--gtest_filter=VectorOpsTest.OrderingsTest]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[VectorOpsTest.OrderingsTest]=]  PROPERTIES WORKING_DIRECTORY /root/repo/bin SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[VectorOpsTest.RankingsTest]=]  /root/repo/bin/tests_main [==[--gtest_filter=VectorOpsTest.RankingsTest]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[VectorOpsTest.RankingsTest]=]  PROPERTIES WORKING_DIRECTORY /root/repo/bin SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[VectorOpsTest.MergeOrderingsTest]=]  /root/repo/bin/tests_main [==[--gtest_filter=VectorOpsTest.MergeOrderingsTest]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[VectorOpsTest.MergeOrderingsTest]=]  PROPERTIES WORKING_DIRECTORY /root/repo/bin SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[VectorOpsTest.RankingsWithTiesTest]=]  /root/repo/bin/tests_main [==[--gtest_filter=VectorOpsTest.RankingsWithTiesTest]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[VectorOpsTest.RankingsWithTiesTest]=]  PROPERTIES WORKING_DIRECTORY /root/repo/bin SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[PhiloxTest.KnownAnswerTest]=]  /root/repo/bin/tests_main [==[--gtest_filter=PhiloxTest.KnownAnswerTest]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[PhiloxTest.KnownAnswerTest]=]  PROPERTIES WORKING_DIRECTORY /root/repo/bin SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[PhiloxTest.SubstreamTest]=]  /root/repo/bin/tests_main [==[--gtest_filter=PhiloxTest.SubstreamTest]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[PhiloxTest.SubstreamTest]=]  PROPERTIES WORKING_DIRECTORY /root/repo/bin SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[PhiloxTest.DiscardTest]=]  /root/repo/bin/tests_main [==[--gtest_filter=PhiloxTest.DiscardTest]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[PhiloxTest.DiscardTest]=]  PROPERTIES WORKING_DIRECTORY /root/repo/bin SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[PhiloxTest.RunSeedTest]=]  /root/repo/bin/tests_main [==[--gtest_filter=PhiloxTest.RunSeedTest]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[PhiloxTest.RunSeedTest]=]  PROPERTIES WORKING_DIRECTORY /root/repo/bin SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[ProfileLogTest.AccumulateTest]=]  /root/repo/bin/tests_main [==[--gtest_filter=ProfileLogTest.AccumulateTest]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[ProfileLogTest.AccumulateTest]=]  PROPERTIES WORKING_DIRECTORY /root/repo/bin SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[ProfileLogTest.CSVTest]=]  /root/repo/bin/tests_main [==[--gtest_filter=ProfileLogTest.CSVTest]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[ProfileLogTest.CSVTest]=]  PROPERTIES WORKING_DIRECTORY /root/repo/bin SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[ProfileLogTest.JSONTest]=]  /root/repo/bin/tests_main [==[--gtest_filter=ProfileLogTest.JSONTest]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[ProfileLogTest.JSONTest]=]  PROPERTIES WORKING_DIRECTORY /root/repo/bin SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[TraceSinkTest.SpanTest]=]  /root/repo/bin/tests_main [==[--gtest_filter=TraceSinkTest.SpanTest]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[TraceSinkTest.SpanTest]=]  PROPERTIES WORKING_DIRECTORY /root/repo/bin SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[TraceSinkTest.ThreadTest]=]  /root/repo/bin/tests_main [==[--gtest_filter=TraceSinkTest.ThreadTest]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[TraceSinkTest.ThreadTest]=]  PROPERTIES WORKING_DIRECTORY /root/repo/bin SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[PopulationTest.SelectGenotypesTest]=]  /root/repo/bin/tests_main [==[--gtest_filter=PopulationTest.SelectGenotypesTest]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[PopulationTest.SelectGenotypesTest]=]  PROPERTIES WORKING_DIRECTORY /root/repo/bin SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[PopulationTest.ChildCountTest]=]  /root/repo/bin/tests_main [==[--gtest_filter=PopulationTest.ChildCountTest]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[PopulationTest.ChildCountTest]=]  PROPERTIES WORKING_DIRECTORY /root/repo/bin SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[CheckpointTest.ResumeTest]=]  /root/repo/bin/tests_main [==[--gtest_filter=CheckpointTest.ResumeTest]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[CheckpointTest.ResumeTest]=]  PROPERTIES WORKING_DIRECTORY /root/repo/bin SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[CheckpointTest.MissingFileTest]=]  /root/repo/bin/tests_main [==[--gtest_filter=CheckpointTest.MissingFileTest]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[CheckpointTest.MissingFileTest]=]  PROPERTIES WORKING_DIRECTORY /root/repo/bin SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[CheckpointTest.TruncatedTest]=]  /root/repo/bin/tests_main [==[--gtest_filter=CheckpointTest.TruncatedTest]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[CheckpointTest.TruncatedTest]=]  PROPERTIES WORKING_DIRECTORY /root/repo/bin SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[CheckpointTest.ForeignFileTest]=]  /root/repo/bin/tests_main [==[--gtest_filter=CheckpointTest.ForeignFileTest]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[CheckpointTest.ForeignFileTest]=]  PROPERTIES WORKING_DIRECTORY /root/repo/bin SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[CheckpointTest.CorruptLengthTest]=]  /root/repo/bin/tests_main [==[--gtest_filter=CheckpointTest.CorruptLengthTest]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[CheckpointTest.CorruptLengthTest]=]  PROPERTIES WORKING_DIRECTORY /root/repo/bin SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[CheckpointTest.CorruptOrderingTest]=]  /root/repo/bin/tests_main [==[--gtest_filter=CheckpointTest.CorruptOrderingTest]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[CheckpointTest.CorruptOrderingTest]=]  PROPERTIES WORKING_DIRECTORY /root/repo/bin SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[CheckpointTest.UnwritableFileTest]=]  /root/repo/bin/tests_main [==[--gtest_filter=CheckpointTest.UnwritableFileTest]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[CheckpointTest.UnwritableFileTest]=]  PROPERTIES WORKING_DIRECTORY /root/repo/bin SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[ConvergenceTest.StrategyChangeTest]=]  /root/repo/bin/tests_main [==[--gtest_filter=ConvergenceTest.StrategyChangeTest]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[ConvergenceTest.StrategyChangeTest]=]  PROPERTIES WORKING_DIRECTORY /root/repo/bin SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[ConvergenceTest.RunUntilConvergedTest]=]  /root/repo/bin/tests_main [==[--gtest_filter=ConvergenceTest.RunUntilConvergedTest]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[ConvergenceTest.RunUntilConvergedTest]=]  PROPERTIES WORKING_DIRECTORY /root/repo/bin SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[ConvergenceTest.BestResponseGapTest]=]  /root/repo/bin/tests_main [==[--gtest_filter=ConvergenceTest.BestResponseGapTest]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[ConvergenceTest.BestResponseGapTest]=]  PROPERTIES WORKING_DIRECTORY /root/repo/bin SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[ConvergenceTest.RoundCapTest]=]  /root/repo/bin/tests_main [==[--gtest_filter=ConvergenceTest.RoundCapTest]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[ConvergenceTest.RoundCapTest]=]  PROPERTIES WORKING_DIRECTORY /root/repo/bin SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[AsyncTest.SnapshotVisibilityTest]=]  /root/repo/bin/tests_main [==[--gtest_filter=AsyncTest.SnapshotVisibilityTest]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[AsyncTest.SnapshotVisibilityTest]=]  PROPERTIES WORKING_DIRECTORY /root/repo/bin SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[AsyncTest.SnapshotConcurrentUpdateTest]=]  /root/repo/bin/tests_main [==[--gtest_filter=AsyncTest.SnapshotConcurrentUpdateTest]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[AsyncTest.SnapshotConcurrentUpdateTest]=]  PROPERTIES WORKING_DIRECTORY /root/repo/bin SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[AsyncTest.CompletionTest]=]  /root/repo/bin/tests_main [==[--gtest_filter=AsyncTest.CompletionTest]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[AsyncTest.CompletionTest]=]  PROPERTIES WORKING_DIRECTORY /root/repo/bin SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[AsyncTest.StalenessBoundTest]=]  /root/repo/bin/tests_main [==[--gtest_filter=AsyncTest.StalenessBoundTest]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[AsyncTest.StalenessBoundTest]=]  PROPERTIES WORKING_DIRECTORY /root/repo/bin SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[AsyncTest.BadArgumentsTest]=]  /root/repo/bin/tests_main [==[--gtest_filter=AsyncTest.BadArgumentsTest]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[AsyncTest.BadArgumentsTest]=]  PROPERTIES WORKING_DIRECTORY /root/repo/bin SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[ParallelTest.CompositeThreadCountTest]=]  /root/repo/bin/tests_main [==[--gtest_filter=ParallelTest.CompositeThreadCountTest]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[ParallelTest.CompositeThreadCountTest]=]  PROPERTIES WORKING_DIRECTORY /root/repo/bin SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[ParallelTest.TierThreadCountTest]=]  /root/repo/bin/tests_main [==[--gtest_filter=ParallelTest.TierThreadCountTest]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[ParallelTest.TierThreadCountTest]=]  PROPERTIES WORKING_DIRECTORY /root/repo/bin SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[LocalSearchTest.SetFloatArrayRoundTripTest]=]  /root/repo/bin/tests_main [==[--gtest_filter=LocalSearchTest.SetFloatArrayRoundTripTest]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[LocalSearchTest.SetFloatArrayRoundTripTest]=]  PROPERTIES WORKING_DIRECTORY /root/repo/bin SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[LocalSearchTest.CoordinateSearchTest]=]  /root/repo/bin/tests_main [==[--gtest_filter=LocalSearchTest.CoordinateSearchTest]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[LocalSearchTest.CoordinateSearchTest]=]  PROPERTIES WORKING_DIRECTORY /root/repo/bin SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[LocalSearchTest.FloatLocalSearchTest]=]  /root/repo/bin/tests_main [==[--gtest_filter=LocalSearchTest.FloatLocalSearchTest]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[LocalSearchTest.FloatLocalSearchTest]=]  PROPERTIES WORKING_DIRECTORY /root/repo/bin SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[LocalSearchTest.MemeticConvergenceTest]=]  /root/repo/bin/tests_main [==[--gtest_filter=LocalSearchTest.MemeticConvergenceTest]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[LocalSearchTest.MemeticConvergenceTest]=]  PROPERTIES WORKING_DIRECTORY /root/repo/bin SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[LocalSearchTest.ResumeTest]=]  /root/repo/bin/tests_main [==[--gtest_filter=LocalSearchTest.ResumeTest]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[LocalSearchTest.ResumeTest]=]  PROPERTIES WORKING_DIRECTORY /root/repo/bin SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[BitMutatorTest.GeometricSkipRateTest]=]  /root/repo/bin/tests_main [==[--gtest_filter=BitMutatorTest.GeometricSkipRateTest]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[BitMutatorTest.GeometricSkipRateTest]=]  PROPERTIES WORKING_DIRECTORY /root/repo/bin SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[BitMutatorTest.GeometricSkipEdgeRatesTest]=]  /root/repo/bin/tests_main [==[--gtest_filter=BitMutatorTest.GeometricSkipEdgeRatesTest]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[BitMutatorTest.GeometricSkipEdgeRatesTest]=]  PROPERTIES WORKING_DIRECTORY /root/repo/bin SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[BitMutatorTest.MutateAllReproducibleTest]=]  /root/repo/bin/tests_main [==[--gtest_filter=BitMutatorTest.MutateAllReproducibleTest]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[BitMutatorTest.MutateAllReproducibleTest]=]  PROPERTIES WORKING_DIRECTORY /root/repo/bin SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+set(  tests_main_TESTS FirstPriceTest.AlwaysWinTest FirstPriceTest.WinHalfTest FirstPriceTest.DecreasingBidsTest FirstPriceTest.DecreasingBids2Test FirstPriceTest.NoIntersectDistsTest FirstPriceTest.BidSegmentTest FirstPriceTest.ExactFitnessTest FirstPriceTest.UtilityTest FirstPriceTest.SinglePrecisionTest FirstPriceTest.MixTest BestResponseTest.FirstPriceTest BestResponseTest.AllPayTest BestResponseTest.SecondPriceTest BestResponseTest.EquilibriumReportTest BestResponseTest.BestResponseGapTest SignalValueDistTest.CachedMatchesUncachedTest SignalValueDistTest.ConcurrentFirstUseTest SignalValueDistTest.ReleasedTablesAreFreedTest SignalValueDistTest.LoadedStrategiesTest ResultsTest.RoundTripTest ResultsTest.UnseededHeaderTest ResultsTest.CSVTest ResultsTest.WriterTest ResultsTest.UnwritableTest ResultsTest.ResumeTest DistributionTest.UniformTest DistributionTest.NormalTest DistributionTest.ExponentialTest DistributionTest.GenericTest DistributionOpsTest.CDF2DTest DistributionOpsTest.PDF2DTest DistributionOpsTest.ExpectedValueFunctionPDFTest DistributionOpsTest.CDFExpectedValueFunctionTest DistributionOpsTest.RandomVariableFunctionCDFTest FunctionOpsTest.InterpolateTest FunctionOpsTest.InterpolateUnevenTest FunctionOpsTest.Interpolote2DTest FunctionOpsTest.InterpoloteUneven2DTest FunctionOpsTest.InverseUnevenTest FunctionOpsTest.InverseUnevenVerticalTest FunctionOpsTest.InverseHorizontalFunctionTest FunctionOpsTest.InverseDecreasingFunctionTest FunctionOpsTest.DerivativeTest FunctionOpsTest.AreasTest FunctionOpsTest.Areas2DTest FunctionOpsTest.IntegralBelowTest FunctionOpsTest.IntegralBelow2DTest FunctionOpsTest.IntegralAboveTest OrderStatisticOpsTest.LowestSingleDistOrderStatisticTest OrderStatisticOpsTest.MiddleSingleDistOrderStatisticTest OrderStatisticOpsTest.HighestSingleDistOrderStatisticTest OrderStatisticOpsTest.LowestMultiDistOrderStatisticTest OrderStatisticOpsTest.MiddleMultiDistOrderStatisticTest OrderStatisticOpsTest.HighestMultiDistOrderStatisticTest IntervalTest.InIntervalTest CombinationGenerationTest.GenerateFirstsTest CombinationGenerationTest.GetNextTest QuadratureTest.PolynomialTest QuadratureTest.KinkTest QuadratureTest.MaxIntervalsTest PiecewiseLinearTest.EvaluateTest PiecewiseLinearTest.SimplifiedTest PiecewiseLinearTest.IntegrateProductTest PiecewiseLinearTest.UniformImageCDFTest PiecewiseLinearTest.ComposeTest PiecewiseLinearTest.ComposeEachTest AliasSamplerTest.MatchesWeightsTest AliasSamplerTest.ResetTest AliasSamplerTest.AllZeroUniformTest VectorOpsTest.OrderingsTest VectorOpsTest.RankingsTest VectorOpsTest.MergeOrderingsTest VectorOpsTest.RankingsWithTiesTest PhiloxTest.KnownAnswerTest PhiloxTest.SubstreamTest PhiloxTest.DiscardTest PhiloxTest.RunSeedTest ProfileLogTest.AccumulateTest ProfileLogTest.CSVTest ProfileLogTest.JSONTest TraceSinkTest.SpanTest TraceSinkTest.ThreadTest PopulationTest.SelectGenotypesTest PopulationTest.ChildCountTest CheckpointTest.ResumeTest CheckpointTest.MissingFileTest CheckpointTest.TruncatedTest CheckpointTest.ForeignFileTest CheckpointTest.CorruptLengthTest CheckpointTest.CorruptOrderingTest CheckpointTest.UnwritableFileTest ConvergenceTest.StrategyChangeTest ConvergenceTest.RunUntilConvergedTest ConvergenceTest.BestResponseGapTest ConvergenceTest.RoundCapTest AsyncTest.SnapshotVisibilityTest AsyncTest.SnapshotConcurrentUpdateTest AsyncTest.CompletionTest AsyncTest.StalenessBoundTest AsyncTest.BadArgumentsTest ParallelTest.CompositeThreadCountTest ParallelTest.TierThreadCountTest LocalSearchTest.SetFloatArrayRoundTripTest LocalSearchTest.CoordinateSearchTest LocalSearchTest.FloatLocalSearchTest LocalSearchTest.MemeticConvergenceTest LocalSearchTest.ResumeTest BitMutatorTest.GeometricSkipRateTest BitMutatorTest.GeometricSkipEdgeRatesTest BitMutatorTest.MutateAllReproducibleTest)
@@ -58,7 +58,7 @@ SinglePopulationGA<binary::ByteArrayGenotype, Phen> BinaryGA(
   using Gen = binary::ByteArrayGenotype;
   int n_bytes = (n_bits + CHAR_BIT - 1) / CHAR_BIT;
   std::vector<Gen> genes;
-  auto generator = std::mt19937(std::random_device()());
+  auto generator = MakeStream();
   std::uniform_int_distribution<int> dist(0, UCHAR_MAX);
   for (int i = 0; i < pop_size; ++i) {
     std::vector<unsigned char> rand_gene(n_bytes);
@@ -11,15 +11,20 @@
 #include "auctions/first_price.h"
 #include "auctions/first_price_reverse.h"
 #include "auctions/second_price.h"
+#include "auctions/signal_value_dist.h"
 
+#include "biddingga/helpers.h"
+#include "biddingga/results.h"
 #include "genericga/binary/bit_mutator.h"
 #include "genericga/binary/byte_array_genotype.h"
 #include "genericga/binary/encoding.h"
+#include "genericga/binary/float_local_search.h"
 #include "genericga/binary/single_point_crossover.h"
 #include "genericga/composite_ga.h"
 #include "genericga/multipop/abstract_sub_ga.h"
 #include "genericga/multipop/ga.h"
 #include "genericga/multipop/sub_ga_adapter.h"
+#include "genericga/parallel.h"
 #include "genericga/selector/elitism_decorator.h"
 #include "genericga/selector/keep_best.h"
 #include "genericga/selector/ranked_weighted.h"
@@ -31,11 +36,21 @@
 #include "numericaldists/distribution.h"
 
 #include <algorithm>
+#include <atomic>
+#include <cassert>
+#include <cctype>
+#include <chrono>
 #include <cstdlib>
 #include <eigen3/Eigen/Core>
 #include <iostream>
 #include <fstream>
+#include <memory>
+#include <mutex>
+#include <set>
+#include <sstream>
+#include <stdexcept>
 #include <string>
+#include <utility>
 
 using namespace genericga;
 using namespace auctions;
@@ -54,6 +69,8 @@ struct BidFunctionGAConfiguration {
   int n_children = 50;
   int n_segments = 30;
   int bit_precision = 32;
+  // Rounds between local searches from each population's best, 0 for none.
+  int local_search_frequency = 0;
 };
 
 struct BinaryToFloat {
@@ -177,7 +194,7 @@ SinglePopulationGA<binary::ByteArrayGenotype, Phen> BinaryGA(
   using Gen = binary::ByteArrayGenotype;
   int n_bytes = (n_bits + CHAR_BIT - 1) / CHAR_BIT;
   std::vector<Gen> genes;
-  auto generator = std::mt19937(std::random_device()());
+  auto generator = MakeStream();
   std::uniform_int_distribution<int> dist(0, UCHAR_MAX);
   for (int i = 0; i < pop_size; ++i) {
     std::vector<unsigned char> rand_gene(n_bytes);
@@ -208,8 +225,13 @@ std::unique_ptr<SinglePopulationGA<Gen, Phen>> Make0DGA(
                                 config.bit_precision);
   binary::FloatEncoding encoding(bid_enc);
   std::function<Phen(const Gen&)> conversion = BinaryToFloat{encoding};
-  return std::make_unique<SinglePopulationGA<Gen, Phen>>(
+  auto ga = std::make_unique<SinglePopulationGA<Gen, Phen>>(
       BinaryGA<Phen>(conversion, config.n_strategies, n_bits));
+  if (config.local_search_frequency > 0) {
+    ga->SetLocalSearch(binary::FloatLocalSearch({encoding}),
+                       config.local_search_frequency);
+  }
+  return ga;
 }
 
 template <class Phen>
@@ -230,8 +252,13 @@ std::unique_ptr<CompositeGA<Phen>> Make1DGA(BidFunctionGAConfiguration config,
     ArrayXd sub_vals = vals.segment(i, n_floats_per_comp);
     std::function<Phen(const Gen&)> conversion =
         BinaryToScatter{sub_vals, encodings};
-    gas.push_back(std::make_shared<SinglePopulationGA<Gen, Phen>>(
-        BinaryGA<Phen>(conversion, config.n_strategies, n_bits)));
+    auto ga = std::make_shared<SinglePopulationGA<Gen, Phen>>(
+        BinaryGA<Phen>(conversion, config.n_strategies, n_bits));
+    if (config.local_search_frequency > 0) {
+      ga->SetLocalSearch(binary::FloatLocalSearch(encodings),
+                         config.local_search_frequency);
+    }
+    gas.push_back(std::move(ga));
   }
   return std::make_unique<CompositeGA<Phen>>(gas,
                                              MedianJoiner{n_floats_per_comp});
@@ -259,114 +286,380 @@ template <class Phen>
 using subga_ptr =
     std::shared_ptr<multipop::SubGAAdapter<CommonValueSignalSecond, Phen>>;
 
-int main(int argc, char** argv) {
-  int n = -1;
-  if (argc < 2) {
-    std::cout << "Usage: " << argv[0] << "Count#" << std::endl;
-    return 1;
-  } else {
-    n = std::atoi(argv[1]);
-    //   for (int i = 1; i < argc; ++i) {
-    //     n_draws.push_back(std::atoi(argv[i]));
-    //   }
-    // }
-    if (n <= 0 || n > 70) {
-      return 1;
-    }
-  }
-  int count = 0;
+constexpr int kInternalSamples = 1001;
+constexpr int kComposites = 10;
+constexpr int kCheckpointFrequency = 50;
+
+// One run of the sweep.  n_strategies is each player's population, split
+// across the composites of players with more than one draw.  With a patience
+// the run stops before n_rounds once it has converged under the tolerances.
+struct SweepConfiguration {
   std::vector<int> n_draws;
+  double epsilon = 500;
+  int n_strategies = 500;
+  int n_segments = 50;
+  int n_rounds = 1000;
+  int patience = 0;
+  double tolerance = 0;
+  double fitness_tolerance = 0;
+  int local_search = 0;
   std::string name;
+};
+
+std::string DefaultName(const std::vector<int>& n_draws) {
+  std::string name = "common_value";
+  for (int draw : n_draws) {
+    name += "_" + std::to_string(draw);
+  }
+  return name + ".results";
+}
+
+// Every ascending tuple of four draw counts from 1 to 5, in the order of the
+// old combination index.
+std::vector<SweepConfiguration> AllConfigurations() {
+  std::vector<SweepConfiguration> configs;
   for (int i = 1; i <= 5; ++i) {
     for (int j = i; j <= 5; ++j) {
       for (int k = j; k <= 5; ++k) {
         for (int l = k; l <= 5; ++l) {
-          if (++count == n) {
-            n_draws = {i, j, k, l};
-            name = "common_value_" + std::to_string(i) + "_" +
-                   std::to_string(j) + "_" + std::to_string(k) + "_" +
-                   std::to_string(l) + ".csv";
-          }
+          SweepConfiguration config;
+          config.n_draws = {i, j, k, l};
+          config.name = DefaultName(config.n_draws);
+          configs.push_back(std::move(config));
         }
       }
     }
   }
-  std::ofstream out_stream(name, std::ofstream::out);
-  double epsilon = 500;
-  Interval range_range{0, 2 * epsilon};
-  Interval bid_range{-4 * epsilon, epsilon};
-
-  int n_composites = 10;
-  std::vector<BidFunctionGAConfiguration> configs;
-  for (int i = 0; i < n_draws.size(); ++i) {
-    BidFunctionGAConfiguration config;
-    config.id = i;
-    config.value_range = {0, 2 * epsilon};
-    config.bid_range = {-4 * epsilon, epsilon};
-    config.n_strategies = 500 / n_composites;
-    config.n_children = 500 / n_composites;
-    config.n_segments = 50;
-    configs.push_back(std::move(config));
+  return configs;
+}
+
+// One configuration per line as key=value fields, any of which may be left
+// at its default except draws, e.g.
+//   draws=1,2,2,5 epsilon=500 strategies=500 segments=50 rounds=1000
+// Blank lines and lines starting with # are skipped.  name= overrides the
+// output file, which is otherwise common_value_<draws>.results.  patience=,
+// tolerance= and fitness_tolerance= turn on early stopping; see
+// multipop::ConvergenceCriteria.  fitness_tolerance= bounds how much each
+// round improves the best bid function's fitness, so stopping on it alone
+// does not show the players are near equilibrium.  local_search= is the
+// number of rounds between coordinate searches from each population's best
+// bid function.
+//
+// Appends to configs.  Prints the problem to cerr and returns false if the
+// file cannot be read or a line is malformed.
+bool ReadConfigurations(const std::string& path,
+                        std::vector<SweepConfiguration>* configs) {
+  std::ifstream is(path);
+  if (!is) {
+    std::cerr << "Cannot open " << path << std::endl;
+    return false;
   }
+  std::string line;
+  int line_number = 0;
+  while (std::getline(is, line)) {
+    ++line_number;
+    std::istringstream fields(line);
+    std::string field;
+    if (!(fields >> field) || field[0] == '#') {
+      continue;
+    }
+    auto error = [&](const std::string& message) {
+      std::cerr << path << ":" << line_number << ": " << message << std::endl;
+      return false;
+    };
+    SweepConfiguration config;
+    do {
+      auto eq = field.find('=');
+      if (eq == std::string::npos) {
+        return error("expected key=value, got " + field);
+      }
+      std::string key = field.substr(0, eq);
+      std::string value = field.substr(eq + 1);
+      try {
+        if (key == "draws") {
+          std::istringstream draws(value);
+          std::string draw;
+          while (std::getline(draws, draw, ',')) {
+            config.n_draws.push_back(std::stoi(draw));
+            if (config.n_draws.back() < 1) {
+              return error("draws must be at least 1");
+            }
+          }
+        } else if (key == "epsilon") {
+          config.epsilon = std::stod(value);
+        } else if (key == "strategies") {
+          config.n_strategies = std::stoi(value);
+        } else if (key == "segments") {
+          config.n_segments = std::stoi(value);
+        } else if (key == "rounds") {
+          config.n_rounds = std::stoi(value);
+        } else if (key == "patience") {
+          config.patience = std::stoi(value);
+        } else if (key == "tolerance") {
+          config.tolerance = std::stod(value);
+        } else if (key == "fitness_tolerance") {
+          config.fitness_tolerance = std::stod(value);
+        } else if (key == "local_search") {
+          config.local_search = std::stoi(value);
+        } else if (key == "name") {
+          config.name = value;
+        } else {
+          return error("unknown key " + key);
+        }
+      } catch (const std::logic_error&) {
+        return error("bad value for " + key + ": " + value);
+      }
+    } while (fields >> field);
+    if (config.n_draws.empty()) {
+      return error("missing draws");
+    }
+    if (config.name.empty()) {
+      config.name = DefaultName(config.n_draws);
+    }
+    configs->push_back(std::move(config));
+  }
+  return true;
+}
 
-  int n_rounds = 1000;
-  CommonValueSignalSecond auction(n_draws, epsilon, {-4 * epsilon, epsilon});
-  // FirstPrice auction(dists);
-
-  std::vector<std::variant<subga_ptr<float>, subga_ptr<Phen>>> gas;
-  for (int i = 0; i < n_draws.size(); ++i) {
-    if (n_draws[i] == 1) {
-      gas.push_back(
-          MakeSub0DGA<CommonValueSignalSecond, float>(std::move(configs[i])));
-    } else {
-      gas.push_back(MakeSub1DGA<CommonValueSignalSecond, Phen>(
-          std::move(configs[i]), n_composites));
+// A configuration's GAs, its copy of the auction for scoring the best
+// strategies, and its results and checkpoint files.  Rerunning an interrupted
+// configuration picks up from its last checkpoint.  Construction and Run
+// throw CheckpointError if the checkpoint cannot be read or written, and Run
+// throws std::runtime_error if the results file cannot be.
+class SweepJob {
+ public:
+  explicit SweepJob(SweepConfiguration config)
+      : config_(std::move(config)),
+        auction_(config_.n_draws, config_.epsilon,
+                 {-4 * config_.epsilon, config_.epsilon}, kInternalSamples) {
+    double epsilon = config_.epsilon;
+    std::vector<std::shared_ptr<
+        multipop::AbstractSubGA<CommonValueSignalSecond>>>
+        sub_gas;
+    for (int i = 0; i < config_.n_draws.size(); ++i) {
+      BidFunctionGAConfiguration ga_config;
+      ga_config.id = i;
+      ga_config.value_range = {0, 2 * epsilon};
+      ga_config.bid_range = {-4 * epsilon, epsilon};
+      ga_config.n_strategies = config_.n_strategies / kComposites;
+      ga_config.n_children = config_.n_strategies / kComposites;
+      ga_config.n_segments = config_.n_segments;
+      ga_config.local_search_frequency = config_.local_search;
+      if (config_.n_draws[i] == 1) {
+        auto ga = MakeSub0DGA<CommonValueSignalSecond, float>(ga_config);
+        sub_gas.push_back(ga);
+        gas_.push_back(std::move(ga));
+      } else {
+        auto ga =
+            MakeSub1DGA<CommonValueSignalSecond, Phen>(ga_config, kComposites);
+        sub_gas.push_back(ga);
+        gas_.push_back(std::move(ga));
+      }
     }
+    driver_ = std::make_unique<multipop::GA<CommonValueSignalSecond>>(
+        std::move(sub_gas), auction_);
+    if (config_.patience > 0) {
+      driver_->SetConvergenceCriteria(
+          {config_.tolerance, config_.fitness_tolerance, config_.patience});
+    }
+    driver_->LoadCheckpointFile(GetCheckpointName());
   }
 
-  std::vector<std::shared_ptr<multipop::AbstractSubGA<CommonValueSignalSecond>>>
-      sub_gas;
-  for (int i = 0; i < n_draws.size(); ++i) {
-    if (n_draws[i] == 1) {
-      sub_gas.push_back(std::get<subga_ptr<float>>(gas[i]));
-    } else {
-      sub_gas.push_back(std::get<subga_ptr<Phen>>(gas[i]));
+  const std::string& GetName() const { return config_.name; }
+
+  bool HasConverged() const { return driver_->HasConverged(); }
+  int GetRoundCount() const { return driver_->GetRoundCount(); }
+
+  // Relative run time of the rounds left, at most.  A player with one draw
+  // evolves a single float, which is cheap to score next to a bid function.
+  double GetCost() const {
+    double per_round = 0;
+    for (int draw : config_.n_draws) {
+      per_round += draw == 1 ? 0.1 : 1;
     }
+    int rounds_left =
+        HasConverged() ? 0 : config_.n_rounds - driver_->GetRoundCount();
+    return per_round * config_.n_strategies * rounds_left;
   }
 
-  auto driver = multipop::GA<CommonValueSignalSecond>(sub_gas, auction);
-  for (int n = 0; n < n_rounds; ++n) {
-    driver.RunRound(1);
-    for (int i = 0; i < gas.size(); ++i) {
-      if (n_draws[i] == 1) {
-        std::cout
-            << std::get<subga_ptr<float>>(gas[i])->GetBestStrategy().phenotype
-            << std::endl;
-        auction.AcceptStrategy(
-            std::get<subga_ptr<float>>(gas[i])->GetBestStrategy().phenotype, i);
-      } else {
-        std::cout
-            << std::get<subga_ptr<Phen>>(gas[i])->GetBestStrategy().phenotype
-            << std::endl;
-        auction.AcceptStrategy(
-            std::get<subga_ptr<Phen>>(gas[i])->GetBestStrategy().phenotype, i);
-      }
+  void Run() {
+    // Checkpoints are taken here rather than by the driver so the results are
+    // flushed first and always reach the checkpointed round.
+    biddingga::ResultsWriter writer(config_.name, 1, driver_->GetRoundCount(),
+                                    GetRunSeed());
+    if (!writer.IsOpen()) {
+      throw std::runtime_error("cannot open results file");
     }
-    for (int i = 0; i < gas.size(); ++i) {
-      if (n_draws[i] == 1) {
-        std::cout << auction.GetFitness(
-            std::get<subga_ptr<float>>(gas[i])->GetBestStrategy().phenotype, i);
-        if (i != gas.size() - 1) {
-          std::cout << ",";
+    const auto& n_draws = config_.n_draws;
+    // Each player's best strategy, in the slot matching its GA.
+    std::vector<float> best_bids(gas_.size());
+    std::vector<Phen> best_functions(gas_.size());
+    int n = driver_->GetRoundCount();
+    for (; n < config_.n_rounds && !HasConverged(); ++n) {
+      driver_->RunRound(1);
+      biddingga::ResultsSnapshot snapshot;
+      snapshot.round = n + 1;
+      for (int i = 0; i < gas_.size(); ++i) {
+        if (n_draws[i] == 1) {
+          best_bids[i] =
+              std::get<subga_ptr<float>>(gas_[i])->GetBestStrategy().phenotype;
+          snapshot.Add("bid_" + std::to_string(i),
+                       std::vector<float>{best_bids[i]});
+          auction_.AcceptStrategy(best_bids[i], i);
+        } else {
+          best_functions[i] =
+              std::get<subga_ptr<Phen>>(gas_[i])->GetBestStrategy().phenotype;
+          snapshot.Add("x_" + std::to_string(i), best_functions[i].xs);
+          snapshot.Add("y_" + std::to_string(i), best_functions[i].ys);
+          auction_.AcceptStrategy(best_functions[i], i);
         }
-      } else {
-        std::cout << auction.GetFitness(
-            std::get<subga_ptr<Phen>>(gas[i])->GetBestStrategy().phenotype, i);
-        if (i != gas.size() - 1) {
-          std::cout << ",";
+      }
+      std::vector<float> fitnesses;
+      for (int i = 0; i < gas_.size(); ++i) {
+        fitnesses.push_back(n_draws[i] == 1
+                                ? auction_.GetFitness(best_bids[i], i)
+                                : auction_.GetFitness(best_functions[i], i));
+      }
+      snapshot.Add("fitness", std::move(fitnesses));
+      if (config_.patience > 0) {
+        std::vector<float> changes;
+        std::vector<float> fitness_changes;
+        for (const auto& change : driver_->GetLastChanges()) {
+          changes.push_back(change.strategy_linf);
+          fitness_changes.push_back(change.fitness_change);
         }
+        snapshot.Add("change", std::move(changes));
+        snapshot.Add("fitness_change", std::move(fitness_changes));
+      }
+      writer.Write(std::move(snapshot));
+      if ((n + 1) % kCheckpointFrequency == 0) {
+        FlushResults(writer);
+        driver_->SaveCheckpointFile(GetCheckpointName());
+      }
+    }
+    // A rerun of a converged job then finds nothing left to do.
+    if (HasConverged() && n % kCheckpointFrequency != 0) {
+      FlushResults(writer);
+      driver_->SaveCheckpointFile(GetCheckpointName());
+    }
+    FlushResults(writer);
+  }
+
+ private:
+  std::string GetCheckpointName() const { return config_.name + ".checkpoint"; }
+  // A checkpoint must never get ahead of the results it resumes.
+  static void FlushResults(biddingga::ResultsWriter& writer) {
+    if (!writer.Flush()) {
+      throw std::runtime_error("cannot write results file");
+    }
+  }
+
+  SweepConfiguration config_;
+  CommonValueSignalSecond auction_;
+  std::vector<std::variant<subga_ptr<float>, subga_ptr<Phen>>> gas_;
+  std::unique_ptr<multipop::GA<CommonValueSignalSecond>> driver_;
+};
+
+// Runs every configuration in one process.  The value distribution tables
+// are built once, in parallel, and shared by all jobs.  Jobs are constructed
+// in file order, so each one's random streams depend only on the
+// configuration list, then taken from a queue most expensive first by
+// however many threads OpenMP provides.  A job's own sub-GA and composite
+// loops become tasks of the same team, so threads left idle at the end of the
+// sweep help finish the jobs still running.
+// Returns false, running nothing, if two configurations share an output name
+// or a job's checkpoint cannot be read, and false after the sweep if any job's
+// results or checkpoint could not be written.
+bool RunSweep(const std::vector<SweepConfiguration>& configs) {
+  std::set<std::string> names;
+  std::set<std::pair<int, double>> tables;
+  for (const auto& config : configs) {
+    bool unique = names.insert(config.name).second;
+    if (!unique) {
+      std::cerr << "Duplicate configuration name " << config.name
+                << std::endl;
+      return false;
+    }
+    for (int draw : config.n_draws) {
+      if (draw > 1) {
+        tables.emplace(draw, config.epsilon);
       }
     }
-    std::cout << std::endl;
   }
+  // Held until every job is built, since the cache only keeps tables that
+  // are still in use.
+  std::vector<std::pair<int, double>> table_list(tables.begin(), tables.end());
+  std::vector<std::shared_ptr<const ArrayXXd>> warm_tables(table_list.size());
+  ParallelFor(table_list.size(), [&](int i) {
+    warm_tables[i] = SharedMidpointSpreadPDF(
+        table_list[i].first, table_list[i].second, kInternalSamples);
+  });
+
+  std::vector<std::unique_ptr<SweepJob>> jobs;
+  for (const auto& config : configs) {
+    try {
+      jobs.push_back(std::make_unique<SweepJob>(config));
+    } catch (const CheckpointError& e) {
+      std::cerr << config.name << ": " << e.what() << std::endl;
+      return false;
+    }
+  }
+  warm_tables.clear();
+  std::stable_sort(jobs.begin(), jobs.end(),
+                   [](const auto& a, const auto& b) {
+                     return a->GetCost() > b->GetCost();
+                   });
+
+  std::atomic<int> next_job(0);
+  std::atomic<bool> all_saved(true);
+  std::mutex log_mutex;
+#pragma omp parallel
+  for (int i = next_job++; i < jobs.size(); i = next_job++) {
+    auto start = std::chrono::steady_clock::now();
+    try {
+      jobs[i]->Run();
+    } catch (const std::runtime_error& e) {
+      all_saved = false;
+      std::lock_guard<std::mutex> lock(log_mutex);
+      std::cerr << jobs[i]->GetName() << ": " << e.what() << std::endl;
+      jobs[i].reset();
+      continue;
+    }
+    std::chrono::duration<double> elapsed =
+        std::chrono::steady_clock::now() - start;
+    std::lock_guard<std::mutex> lock(log_mutex);
+    std::cout << jobs[i]->GetName()
+              << (jobs[i]->HasConverged() ? " converged at round "
+                                          : " finished at round ")
+              << jobs[i]->GetRoundCount() << " in " << elapsed.count() << "s"
+              << std::endl;
+    jobs[i].reset();
+  }
+  return all_saved;
+}
+
+// The run seed is recorded in each results file's header.  The GAs are built
+// in configuration order, so rerunning the same configurations with the same
+// seed=<n> repeats the sweep.
+int main(int argc, char** argv) {
+  biddingga::SeedFromArgs(&argc, argv);
+  if (argc < 2) {
+    std::cout << "Usage: " << argv[0]
+              << " Count# | ConfigurationFile [seed=<n>]" << std::endl;
+    return 1;
+  }
+  std::string arg = argv[1];
+  std::vector<SweepConfiguration> configs;
+  if (std::all_of(arg.begin(), arg.end(), ::isdigit)) {
+    // A single configuration by its index in AllConfigurations, from 1.
+    int n = std::atoi(argv[1]);
+    auto all = AllConfigurations();
+    if (n <= 0 || n > all.size()) {
+      return 1;
+    }
+    configs.push_back(all[n - 1]);
+  } else if (!ReadConfigurations(arg, &configs)) {
+    return 1;
+  }
+  return RunSweep(configs) ? 0 : 1;
 }
@@ -5,6 +5,7 @@
 #include "auctions/common_value_signal_endpoints.h"
 
 #include "biddingga/configuration.h"
+#include "biddingga/helpers.h"
 #include "biddingga/initializers_1d.h"
 #include "biddingga/initializers_2d.h"
 #include "genericga/binary/bit_mutator.h"
@@ -63,9 +64,10 @@ using subga_ptr =
     std::shared_ptr<multipop::SubGAAdapter<CommonValueSignalEndpoints, Phen>>;
 
 int main(int argc, char** argv) {
+  std::uint64_t seed = biddingga::SeedFromArgs(&argc, argv);
   int n = -1;
   if (argc < 2) {
-    std::cout << "Usage: " << argv[0] << "Count#" << std::endl;
+    std::cout << "Usage: " << argv[0] << " Count# [seed=<n>]" << std::endl;
     return 1;
   } else {
     n = std::atoi(argv[1]);
@@ -96,6 +98,7 @@ int main(int argc, char** argv) {
     }
   }
   std::ofstream out_stream(name, std::ofstream::out);
+  out_stream << "seed," << seed << std::endl;
 
   double epsilon = 500;
   double min_value = 500;
@@ -2,10 +2,12 @@
 #define AUCTIONS_ALL_PAY_H_
 
 #include <functional>
+#include <utility>
 #include <vector>
 
 #include <iostream>
 
+#include "auctions/value_transform.h"
 #include "numericaldists/distribution.h"
 #include "numericaldists/function_ops.h"
 #include "numericaldists/interval.h"
@@ -24,15 +26,45 @@ class AllPay {
   float GetRevenue(const numericaldists::Scatter& bid_func, int id) const;
   float GetValue(const numericaldists::Scatter& bid_func, int id) const;
 
+  // As FirstPrice::BestResponse, with every bid paid.
+  numericaldists::Scatter BestResponse(int id, int n_values = 101,
+                                       int n_bids = 1001) const;
+
+  // With a positive tolerance GetFitness integrates over values with adaptive
+  // Gauss-Kronrod quadrature instead of the fixed 3x oversampled trapezoid
+  // grid.  The default of 0 keeps the fixed grid.
+  void SetIntegrationTolerance(double tolerance) {
+    integration_tolerance_ = tolerance;
+  }
+
+  // Fictitious-play environment for a batch of environments: each player's
+  // bid CDF is the average of its CDFs across envs, so a bid function is
+  // scored against the whole batch with one GetFitness call.  With two players
+  // and identity probability weighting, fitness is linear in the opponent's CDF
+  // and this matches averaging GetFitness over envs.  With more players it
+  // treats opponents as mixing independently over their strategies.
+  static AllPay Mix(const std::vector<AllPay*>& envs);
+
+  void SetUtility(int id, ValueTransform utility) {
+    utility_funcs_[id] = std::move(utility);
+  }
+  void SetProbabilityWeighting(int id, ValueTransform weighting) {
+    prob_weight_funcs_[id] = std::move(weighting);
+  }
+
  private:
   float GetIntegrand(const Eigen::ArrayXd& bid_func, int id, float value) const;
+  // Expected utility density at each of values.
+  Eigen::ArrayXd FitnessIntegrand(const numericaldists::Scatter& bid_func,
+                                  int id, const Eigen::ArrayXd& values) const;
   std::vector<numericaldists::Scatter> value_pdfs_;
   std::vector<numericaldists::Scatter> bid_cdfs_;
-  std::vector<std::function<double(double)>> utility_funcs_;
-  std::vector<std::function<double(double)>> prob_weight_funcs_;
+  std::vector<ValueTransform> utility_funcs_;
+  std::vector<ValueTransform> prob_weight_funcs_;
   int n_players_;
   int n_internal_samples_;
   double max_bid_;
+  double integration_tolerance_ = 0;
 };
 
 }  // namespace auctions
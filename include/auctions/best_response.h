@@ -0,0 +1,76 @@
+#ifndef AUCTIONS_BEST_RESPONSE_H_
+#define AUCTIONS_BEST_RESPONSE_H_
+
+#include <algorithm>
+#include <cassert>
+#include <functional>
+#include <memory>
+#include <vector>
+
+#include "numericaldists/scatter.h"
+
+#include <eigen3/Eigen/Core>
+
+namespace auctions {
+
+// For each row of utilities (a value) the bid of the column that maximizes
+// it, taking the lowest such bid on ties and skipping NaNs.  Columns of
+// utilities match bids.
+Eigen::ArrayXd BestBids(const Eigen::ArrayXXd& utilities,
+                        const Eigen::ArrayXd& bids);
+
+// How far a strategy profile is from equilibrium.  Every entry is per player:
+// its fitness, the fitness of its best response to the others, and the gain
+// from switching to it.  The profile is an epsilon-equilibrium for the
+// largest gain; gains can be slightly negative when a strategy is already a
+// best response, since the best response is only found on a grid.
+struct EquilibriumReport {
+  std::vector<float> fitnesses;
+  std::vector<float> best_response_fitnesses;
+  std::vector<float> gains;
+  float epsilon = 0;
+};
+
+// Accepts strategies into a copy of auction and scores each player's
+// strategy and Auction::BestResponse with GetFitness.
+template <class Auction>
+EquilibriumReport GetEquilibriumReport(
+    Auction auction, const std::vector<numericaldists::Scatter>& strategies,
+    int n_values = 101, int n_bids = 1001) {
+  int n_players = strategies.size();
+  for (int id = 0; id < n_players; ++id) {
+    auction.AcceptStrategy(strategies[id], id);
+  }
+  EquilibriumReport report;
+  for (int id = 0; id < n_players; ++id) {
+    float fitness = auction.GetFitness(strategies[id], id);
+    float best_fitness =
+        auction.GetFitness(auction.BestResponse(id, n_values, n_bids), id);
+    report.fitnesses.push_back(fitness);
+    report.best_response_fitnesses.push_back(best_fitness);
+    report.gains.push_back(best_fitness - fitness);
+    report.epsilon = std::max(report.epsilon, best_fitness - fitness);
+  }
+  return report;
+}
+
+// A best_response_gap for genericga::multipop::ConvergenceCriteria: the
+// epsilon of GetEquilibriumReport for the best strategies of gas, which must
+// hold one sub-GA per player of auction, each playing as its GetID().
+template <class Auction, class SubGA>
+std::function<double()> MakeBestResponseGap(
+    Auction auction, std::vector<std::shared_ptr<SubGA>> gas,
+    int n_values = 101, int n_bids = 1001) {
+  return [auction = std::move(auction), gas = std::move(gas), n_values,
+          n_bids]() -> double {
+    std::vector<numericaldists::Scatter> strategies(gas.size());
+    for (const auto& ga : gas) {
+      strategies[ga->GetID()] = ga->GetBestStrategy().phenotype;
+    }
+    return GetEquilibriumReport(auction, strategies, n_values, n_bids).epsilon;
+  };
+}
+
+}  // namespace auctions
+
+#endif  // AUCTIONS_BEST_RESPONSE_H_
@@ -3,8 +3,11 @@
 
 #include <omp.h>
 #include <functional>
+#include <utility>
+#include <memory>
 #include <vector>
 
+#include "auctions/value_transform.h"
 #include "numericaldists/distribution.h"
 #include "numericaldists/grid.h"
 #include "numericaldists/interval.h"
@@ -38,10 +41,19 @@ class CommonValueEndpoints {
     return fits;
   }
 
+  // Rebuilds others_bids_cdfs_ if a strategy changed since the last call.
+  void Precalculate() const;
+
+  void SetUtility(int id, ValueTransform utility) {
+    utility_funcs_[id] = std::move(utility);
+  }
+  void SetProbabilityWeighting(int id, ValueTransform weighting) {
+    prob_weight_funcs_[id] = std::move(weighting);
+  }
+
  private:
   double GetIntegrand(const numericaldists::Scatter& rel_bid_func, int id,
                       float value) const;
-  void Precalculate() const;
 
   int n_players_;
   mutable bool pre_calculated_;
@@ -50,9 +62,11 @@ class CommonValueEndpoints {
   Eigen::ArrayXd internal_values_;
   Eigen::ArrayXd internal_signals_;
   Eigen::ArrayXd internal_bids_;
-  Eigen::ArrayXXd value_pdf_;
-  std::vector<std::function<double(double)>> utility_funcs_;
-  std::vector<std::function<double(double)>> prob_weight_funcs_;
+  // Depends only on the constructor arguments, so copies of the environment
+  // (e.g. multipop::GA memory slots) share one table.
+  std::shared_ptr<const Eigen::ArrayXXd> value_pdf_;
+  std::vector<ValueTransform> utility_funcs_;
+  std::vector<ValueTransform> prob_weight_funcs_;
 };
 
 }  // namespace auctions
@@ -3,8 +3,10 @@
 
 #include <omp.h>
 #include <functional>
+#include <utility>
 #include <vector>
 
+#include "auctions/value_transform.h"
 #include "numericaldists/distribution.h"
 #include "numericaldists/grid.h"
 #include "numericaldists/interval.h"
@@ -37,10 +39,19 @@ class CommonValueEndpoints2 {
     return fits;
   }
 
+  // Rebuilds others_bids_cdfs_ if a strategy changed since the last call.
+  void Precalculate() const;
+
+  void SetUtility(int id, ValueTransform utility) {
+    utility_funcs_[id] = std::move(utility);
+  }
+  void SetProbabilityWeighting(int id, ValueTransform weighting) {
+    prob_weight_funcs_[id] = std::move(weighting);
+  }
+
  private:
   double GetIntegrand(const numericaldists::Scatter& rel_bid_func, int id,
                       float value) const;
-  void Precalculate() const;
 
   int n_players_;
   mutable bool pre_calculated_;
@@ -50,8 +61,8 @@ class CommonValueEndpoints2 {
   Eigen::ArrayXd internal_signals_;
   Eigen::ArrayXd internal_bids_;
   Eigen::ArrayXd value_pdf_;
-  std::vector<std::function<double(double)>> utility_funcs_;
-  std::vector<std::function<double(double)>> prob_weight_funcs_;
+  std::vector<ValueTransform> utility_funcs_;
+  std::vector<ValueTransform> prob_weight_funcs_;
   numericaldists::Distribution error_dist_;
 };
 
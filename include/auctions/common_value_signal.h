@@ -3,8 +3,13 @@
 
 #include <omp.h>
 #include <functional>
+#include <istream>
+#include <utility>
+#include <memory>
+#include <ostream>
 #include <vector>
 
+#include "auctions/value_transform.h"
 #include "numericaldists/distribution.h"
 #include "numericaldists/grid.h"
 #include "numericaldists/interval.h"
@@ -39,6 +44,11 @@ class CommonValueSignal {
   }
 
   float GetFitness(const float rel_bid_value, int id) const;
+  // Constant relative bids integrate over one signal dimension only; a
+  // positive tolerance integrates it adaptively instead of on a fixed grid.
+  void SetIntegrationTolerance(double tolerance) {
+    integration_tolerance_ = tolerance;
+  }
   std::vector<float> GetFitness(const std::vector<float>& rel_bids,
                                 int id) const {
     if (!pre_calculated_) {
@@ -53,13 +63,27 @@ class CommonValueSignal {
     return fits;
   }
 
+  // Rebuilds others_bids_cdfs_ if a strategy changed since the last call.
+  void Precalculate() const;
+
+  // The accepted strategies, for multipop::GA checkpoints.
+  void SaveCheckpoint(std::ostream& os) const;
+  void LoadCheckpoint(std::istream& is);
+
+  void SetUtility(int id, ValueTransform utility) {
+    utility_funcs_[id] = std::move(utility);
+  }
+  void SetProbabilityWeighting(int id, ValueTransform weighting) {
+    prob_weight_funcs_[id] = std::move(weighting);
+  }
+
  private:
   double GetIntegrand(const numericaldists::Scatter& rel_bid_func, int id,
                       float value) const;
-  void Precalculate() const;
 
   int n_players_;
   mutable bool pre_calculated_;
+  double integration_tolerance_ = 0;
   std::vector<int> n_draws_;
   std::vector<numericaldists::Scatter> rel_bid_funcs_;
   std::vector<float> one_draw_rel_bids_;
@@ -68,12 +92,14 @@ class CommonValueSignal {
   Eigen::ArrayXd internal_precs_;
   Eigen::ArrayXd internal_bids_;
   Eigen::ArrayXd internal_signals_;
-  std::vector<Eigen::ArrayXXd> value_dists_;
+  // Per player, null for one draw.  Shared with every auction built with the
+  // same epsilon and internal samples; see SharedMidpointSpreadPDF.
+  std::vector<std::shared_ptr<const Eigen::ArrayXXd>> value_dists_;
   Eigen::ArrayXd one_draw_pdf_;
   int n_internal_samples_;
   int mstar_integration_samples_;
-  std::vector<std::function<double(double)>> utility_funcs_;
-  std::vector<std::function<double(double)>> prob_weight_funcs_;
+  std::vector<ValueTransform> utility_funcs_;
+  std::vector<ValueTransform> prob_weight_funcs_;
 };
 
 }  // namespace auctions
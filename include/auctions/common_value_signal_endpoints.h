@@ -3,8 +3,11 @@
 
 #include <omp.h>
 #include <functional>
+#include <utility>
+#include <memory>
 #include <vector>
 
+#include "auctions/value_transform.h"
 #include "numericaldists/grid.h"
 #include "numericaldists/interval.h"
 #include "numericaldists/scatter.h"
@@ -57,10 +60,19 @@ class CommonValueSignalEndpoints {
                                Eigen::ArrayXd midpoints,
                                Eigen::ArrayXd uncertainties) const;
 
+  // Rebuilds others_bids_cdfs_ if a strategy changed since the last call.
+  void Precalculate() const;
+
+  void SetUtility(int id, ValueTransform utility) {
+    utility_funcs_[id] = std::move(utility);
+  }
+  void SetProbabilityWeighting(int id, ValueTransform weighting) {
+    prob_weight_funcs_[id] = std::move(weighting);
+  }
+
  private:
   double GetIntegrand(const numericaldists::Grid& bid_func, int id,
                       float value) const;
-  void Precalculate() const;
 
   int n_players_;
   int n_internal_samples_;
@@ -74,9 +86,10 @@ class CommonValueSignalEndpoints {
   Eigen::ArrayXd internal_uncertainties_;
   Eigen::ArrayXd internal_bids_;
   Eigen::ArrayXd value_pdf_;
-  std::vector<numericaldists::Grid> relative_pdfs_;
-  std::vector<std::function<double(double)>> utility_funcs_;
-  std::vector<std::function<double(double)>> prob_weight_funcs_;
+  // Fixed at construction and shared between copies.
+  std::shared_ptr<const std::vector<numericaldists::Grid>> relative_pdfs_;
+  std::vector<ValueTransform> utility_funcs_;
+  std::vector<ValueTransform> prob_weight_funcs_;
   boost::math::uniform_distribution<> error_dist_;
 };
 
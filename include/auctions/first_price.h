@@ -2,13 +2,16 @@
 #define AUCTIONS_FIRST_PRICE_H_
 
 #include <functional>
+#include <utility>
 #include <vector>
 
 #include <iostream>
 
+#include "auctions/value_transform.h"
 #include "numericaldists/distribution.h"
 #include "numericaldists/function_ops.h"
 #include "numericaldists/interval.h"
+#include "numericaldists/piecewise_linear.h"
 #include "numericaldists/scatter.h"
 
 #include <eigen3/Eigen/Core>
@@ -24,15 +27,66 @@ class FirstPrice {
   float GetRevenue(const numericaldists::Scatter& bid_func, int id) const;
   float GetValue(const numericaldists::Scatter& bid_func, int id) const;
 
+  // Player id's best response to the strategies accepted from the others: at
+  // each of n_values values across its support, whichever of n_bids evenly
+  // spaced bids on [0, highest value] has the highest expected utility.  The
+  // whole value by bid grid is scored at once, so this takes milliseconds.
+  numericaldists::Scatter BestResponse(int id, int n_values = 101,
+                                       int n_bids = 1001) const;
+
+  // For a risk-neutral player, when every player's values are uniform and the
+  // bid functions span their supports, GetFitness is exact and costs
+  // O(segments).  Otherwise it sums trapezoids on a 3x oversampled grid.  A
+  // positive tolerance overrides both with adaptive Gauss-Kronrod quadrature
+  // over values.
+  void SetIntegrationTolerance(double tolerance) {
+    integration_tolerance_ = tolerance;
+  }
+  // Scores the grid path in float, which halves the memory traffic and doubles
+  // the SIMD width.  Revenue and value reporting stay in double.
+  void SetSinglePrecision(bool single_precision);
+
+  // Fictitious-play environment for a batch of environments: each player's
+  // bid CDF is the average of its CDFs across envs, so a bid function is
+  // scored against the whole batch with one GetFitness call.  With two players
+  // and identity probability weighting, fitness is linear in the opponent's CDF
+  // and this matches averaging GetFitness over envs.  With more players it
+  // treats opponents as mixing independently over their strategies.
+  static FirstPrice Mix(const std::vector<FirstPrice*>& envs);
+
+  void SetUtility(int id, ValueTransform utility) {
+    utility_funcs_[id] = std::move(utility);
+  }
+  void SetProbabilityWeighting(int id, ValueTransform weighting) {
+    prob_weight_funcs_[id] = std::move(weighting);
+  }
+
  private:
   float GetIntegrand(const Eigen::ArrayXd& bid_func, int id, float value) const;
+  // Expected utility density at each of values.
+  Eigen::ArrayXd FitnessIntegrand(const numericaldists::Scatter& bid_func,
+                                  int id, const Eigen::ArrayXd& values) const;
+  bool CoversUniformValues(const numericaldists::Scatter& bids, int id) const;
+  bool HasExactFitness(const numericaldists::Scatter& bids, int id) const;
+  float GetExactFitness(const numericaldists::Scatter& bids, int id) const;
+  float GetSingleFitness(const numericaldists::Scatter& bids, int id) const;
+  void UpdateSingle(int id);
   std::vector<numericaldists::Scatter> value_pdfs_;
   std::vector<numericaldists::Scatter> bid_cdfs_;
-  std::vector<std::function<double(double)>> utility_funcs_;
-  std::vector<std::function<double(double)>> prob_weight_funcs_;
+  // Exact CDFs of bids under uniform values; empty where unavailable.
+  std::vector<numericaldists::PiecewiseLinear> exact_bid_cdfs_;
+  // Value density of each player if uniform, else 0.
+  std::vector<double> uniform_densities_;
+  // Float copies of value_pdfs_ and bid_cdfs_ ys when single_precision_.
+  std::vector<Eigen::ArrayXf> value_pdfs_single_;
+  std::vector<Eigen::ArrayXf> bid_cdfs_single_;
+  std::vector<ValueTransform> utility_funcs_;
+  std::vector<ValueTransform> prob_weight_funcs_;
   int n_players_;
   int n_internal_samples_;
   double max_bid_;
+  double integration_tolerance_ = 0;
+  bool single_precision_ = false;
 };
 
 }  // namespace auctions
@@ -2,10 +2,12 @@
 #define AUCTIONS_FIRST_PRICE_2D_H_
 
 #include <functional>
+#include <utility>
 #include <vector>
 
 #include <iostream>
 
+#include "auctions/value_transform.h"
 #include "numericaldists/distribution.h"
 #include "numericaldists/function_ops.h"
 #include "numericaldists/grid_multi.h"
@@ -31,15 +33,23 @@ class FirstPrice2D {
                            int id) const;
   float GetExpectedValue(const numericaldists::GridMulti& bid_func,
                          int id) const;
+
+  void SetProbabilityWeighting(int id, ValueTransform weighting) {
+    prob_weight_funcs_[id] = std::move(weighting);
+  }
+
  private:
   void Initialize(
       const std::vector<numericaldists::Distribution>& valuex_dists,
       const std::vector<numericaldists::Distribution>& valuey_dists);
   float GetIntegrand(const Eigen::ArrayXd& bid_func, int id, float value) const;
+  Eigen::ArrayXXd BundleValue(int id, const Eigen::ArrayXXd& valsx,
+                              const Eigen::ArrayXXd& valsy) const;
+  double BundleValue(int id, double valx, double valy) const;
   std::vector<numericaldists::Grid> value_pdfs_;
   std::vector<numericaldists::Grid> bid_cdfs_;
   std::vector<std::function<double(double, double)>> utility_funcs_;
-  std::vector<std::function<double(double)>> prob_weight_funcs_;
+  std::vector<ValueTransform> prob_weight_funcs_;
   std::vector<numericaldists::Scatter> bid_margx_cdfs_;
   std::vector<numericaldists::Scatter> bid_margy_cdfs_;
   int n_players_;
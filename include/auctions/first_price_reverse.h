@@ -2,10 +2,12 @@
 #define AUCTIONS_FIRST_PRICE_REVERSE_H_
 
 #include <functional>
+#include <utility>
 #include <vector>
 
 #include <iostream>
 
+#include "auctions/value_transform.h"
 #include "numericaldists/distribution.h"
 #include "numericaldists/function_ops.h"
 #include "numericaldists/interval.h"
@@ -22,12 +24,19 @@ class FirstPriceReverse {
   void AcceptStrategy(const numericaldists::Scatter& bids, int id);
   float GetFitness(const numericaldists::Scatter& bid_func, int id) const;
 
+  void SetUtility(int id, ValueTransform utility) {
+    utility_funcs_[id] = std::move(utility);
+  }
+  void SetProbabilityWeighting(int id, ValueTransform weighting) {
+    prob_weight_funcs_[id] = std::move(weighting);
+  }
+
  private:
   float GetIntegrand(const Eigen::ArrayXd& bid_func, int id, float value) const;
   std::vector<numericaldists::Scatter> cost_pdfs_;
   std::vector<numericaldists::Scatter> bid_cdfs_;
-  std::vector<std::function<double(double)>> utility_funcs_;
-  std::vector<std::function<double(double)>> prob_weight_funcs_;
+  std::vector<ValueTransform> utility_funcs_;
+  std::vector<ValueTransform> prob_weight_funcs_;
   int n_players_;
   int n_internal_samples_;
 };
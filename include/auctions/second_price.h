@@ -3,7 +3,9 @@
 
 #include <omp.h>
 #include <functional>
+#include <utility>
 
+#include "auctions/value_transform.h"
 #include "numericaldists/distribution.h"
 #include "numericaldists/scatter.h"
 
@@ -19,6 +21,18 @@ class SecondPrice {
   float GetFitness(const numericaldists::Scatter& bids, int id) const;
   float GetRevenue(const numericaldists::Scatter& bids, int id) const;
   float GetValue(const numericaldists::Scatter& bids, int id) const;
+
+  // As FirstPrice::BestResponse, paying the expected highest other bid.  For
+  // a risk-neutral player this recovers bidding its value, up to the bid
+  // grid.
+  numericaldists::Scatter BestResponse(int id, int n_values = 101,
+                                       int n_bids = 1001) const;
+
+  // A positive tolerance switches GetFitness from the fixed trapezoid grid to
+  // adaptive Gauss-Kronrod quadrature over values.
+  void SetIntegrationTolerance(double tolerance) {
+    integration_tolerance_ = tolerance;
+  }
   std::vector<float> GetFitness(
       const std::vector<numericaldists::Scatter>& funcs, int id) const {
     if (!pre_calculated_) {
@@ -33,19 +47,33 @@ class SecondPrice {
     return fits;
   }
 
- private:
+  // Rebuilds other_highest_cdfs_ and exp_value_funcs_ if a strategy changed.
+  // Call before sharing GetFitness between threads.
   void Precalculate() const;
+
+  void SetUtility(int id, ValueTransform utility) {
+    utility_funcs_[id] = std::move(utility);
+  }
+  void SetProbabilityWeighting(int id, ValueTransform weighting) {
+    prob_weight_funcs_[id] = std::move(weighting);
+  }
+
+ private:
+  // Expected utility density at each of values.  Needs Precalculate.
+  Eigen::ArrayXd FitnessIntegrand(const numericaldists::Scatter& bids,
+                                  int id, const Eigen::ArrayXd& values) const;
   Eigen::ArrayXd internal_values_;
   Eigen::ArrayXd internal_bids_;
   std::vector<Eigen::ArrayXd> value_pdfs_;
   std::vector<Eigen::ArrayXd> bid_cdfs_;
   mutable std::vector<Eigen::ArrayXd> other_highest_cdfs_;
   mutable std::vector<Eigen::ArrayXd> exp_value_funcs_;
-  std::vector<std::function<double(double)>> utility_funcs_;
-  std::vector<std::function<double(double)>> prob_weight_funcs_;
+  std::vector<ValueTransform> utility_funcs_;
+  std::vector<ValueTransform> prob_weight_funcs_;
   int n_players_;
   int n_internal_samples_;
   mutable bool pre_calculated_;
+  double integration_tolerance_ = 0;
 };
 
 }  // namespace auctions
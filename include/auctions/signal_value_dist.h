@@ -0,0 +1,37 @@
+#ifndef AUCTIONS_SIGNAL_VALUE_DIST_H_
+#define AUCTIONS_SIGNAL_VALUE_DIST_H_
+
+#include <memory>
+#include <vector>
+
+#include <eigen3/Eigen/Core>
+
+#include "numericaldists/scatter.h"
+
+namespace auctions {
+
+// The joint density of the midpoint and spread of n_draws signals, each the
+// common value plus an error uniform on [-epsilon, epsilon], relative to the
+// common value.  Rows are n_samples midpoints on [-epsilon, epsilon], columns
+// n_samples spreads on [0, 2 * epsilon].  n_draws must be at least 2.
+Eigen::ArrayXXd MidpointSpreadPDF(int n_draws, float epsilon, int n_samples);
+
+// MidpointSpreadPDF, shared between every caller that holds the table for the
+// same arguments.  The cache only keeps tables alive while some caller does,
+// so a table is rebuilt if it is asked for again after the last holder lets
+// it go.  Callers with different arguments build concurrently, callers with
+// the same arguments wait for the first.
+std::shared_ptr<const Eigen::ArrayXXd> SharedMidpointSpreadPDF(
+    int n_draws, float epsilon, int n_samples);
+
+// Throws genericga::CheckpointError unless strategies read back from a
+// checkpoint fit an auction whose bid functions are defined over the spreads
+// precs: a constant bid per player, and every bid function either unset or
+// at least two knots, as many xs as ys, inside the range of precs.
+void CheckLoadedStrategies(
+    const std::vector<numericaldists::Scatter>& rel_bid_funcs,
+    const std::vector<float>& one_draw_rel_bids, const Eigen::ArrayXd& precs);
+
+}  // namespace auctions
+
+#endif  // AUCTIONS_SIGNAL_VALUE_DIST_H_
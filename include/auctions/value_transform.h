@@ -0,0 +1,117 @@
+#ifndef AUCTIONS_VALUE_TRANSFORM_H_
+#define AUCTIONS_VALUE_TRANSFORM_H_
+
+#include <cassert>
+#include <cmath>
+#include <functional>
+#include <type_traits>
+#include <utility>
+
+#include <eigen3/Eigen/Core>
+
+namespace auctions {
+
+// Utility over payoffs or weighting over probabilities, applied to whole
+// arrays.  The kind is dispatched once per array, so identity, CRRA and CARA
+// run as plain Eigen expressions; any other function is a std::function
+// applied per element.  Default constructed it is the identity.
+class ValueTransform {
+ public:
+  ValueTransform() {}
+  // Any double(double) callable.
+  template <class Func, class = std::enable_if_t<!std::is_same_v<
+                            std::decay_t<Func>, ValueTransform>>>
+  ValueTransform(Func func) : kind_(Kind::kCustom), func_(std::move(func)) {}
+
+  // x^(1 - r), mirrored for losses so that it stays increasing.  0 <= r < 1.
+  static ValueTransform CRRA(double risk_aversion) {
+    assert(0 <= risk_aversion && risk_aversion < 1);
+    return ValueTransform(Kind::kCRRA, risk_aversion);
+  }
+  // (1 - exp(-a x)) / a for a != 0.
+  static ValueTransform CARA(double risk_aversion) {
+    assert(risk_aversion != 0);
+    return ValueTransform(Kind::kCARA, risk_aversion);
+  }
+
+  bool IsIdentity() const { return kind_ == Kind::kIdentity; }
+
+  double operator()(double x) const {
+    switch (kind_) {
+      case Kind::kIdentity:
+        return x;
+      case Kind::kCRRA:
+        return std::copysign(std::pow(std::abs(x), 1 - param_), x);
+      case Kind::kCARA:
+        return -std::expm1(-param_ * x) / param_;
+      case Kind::kCustom:
+        return func_(x);
+    }
+    return x;
+  }
+
+  // Works for float as well as double arrays.
+  template <class Derived>
+  typename Derived::PlainObject operator()(
+      const Eigen::ArrayBase<Derived>& xs) const {
+    using Scalar = typename Derived::Scalar;
+    Scalar param = param_;
+    switch (kind_) {
+      case Kind::kIdentity:
+        return xs;
+      case Kind::kCRRA:
+        return xs.sign() * xs.abs().pow(1 - param);
+      case Kind::kCARA:
+        return (1 - (-param * xs).exp()) / param;
+      case Kind::kCustom:
+        return xs.template cast<double>()
+            .unaryExpr(func_)
+            .template cast<Scalar>();
+    }
+    return xs;
+  }
+
+ private:
+  enum class Kind { kIdentity, kCRRA, kCARA, kCustom };
+  ValueTransform(Kind kind, double param) : kind_(kind), param_(param) {}
+
+  Kind kind_ = Kind::kIdentity;
+  double param_ = 0;
+  std::function<double(double)> func_;
+};
+
+// Expected utility of win_payoffs with probability win_probs and
+// lose_payoffs otherwise, with both probabilities weighted.  When utility
+// and weighting are identities this is a single fused Eigen expression.
+template <class Payoffs, class Probs, class LosePayoffs>
+typename Payoffs::PlainObject ExpectedUtility(
+    const ValueTransform& utility, const ValueTransform& weighting,
+    const Eigen::ArrayBase<Payoffs>& win_payoffs,
+    const Eigen::ArrayBase<Probs>& win_probs,
+    const Eigen::ArrayBase<LosePayoffs>& lose_payoffs) {
+  if (utility.IsIdentity() && weighting.IsIdentity()) {
+    return win_payoffs * win_probs + lose_payoffs * (1 - win_probs);
+  }
+  return utility(win_payoffs) * weighting(win_probs) +
+         utility(lose_payoffs) * weighting(1 - win_probs);
+}
+
+template <class Payoffs, class Probs>
+typename Payoffs::PlainObject ExpectedUtility(
+    const ValueTransform& utility, const ValueTransform& weighting,
+    const Eigen::ArrayBase<Payoffs>& win_payoffs,
+    const Eigen::ArrayBase<Probs>& win_probs, double lose_payoff = 0) {
+  using Scalar = typename Payoffs::Scalar;
+  if (utility.IsIdentity() && weighting.IsIdentity()) {
+    if (lose_payoff == 0) {
+      return win_payoffs * win_probs;
+    }
+    return win_payoffs * win_probs + Scalar(lose_payoff) * (1 - win_probs);
+  }
+  return utility(win_payoffs) * weighting(win_probs) +
+         Scalar(utility(lose_payoff)) * weighting(1 - win_probs);
+}
+
+}  // namespace auctions
+
+#endif  // AUCTIONS_VALUE_TRANSFORM_H_
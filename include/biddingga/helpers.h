@@ -1,6 +1,7 @@
 #ifndef BIDDINGGA_HELPERS_H_
 #define BIDDINGGA_HELPERS_H_
 
+#include <cstdint>
 #include <random>
 #include <vector>
 
@@ -8,6 +9,7 @@
 #include "genericga/multipop/abstract_sub_ga.h"
 #include "genericga/multipop/ga.h"
 #include "genericga/multipop/sub_ga_adapter.h"
+#include "genericga/random.h"
 
 namespace biddingga {
 
@@ -21,11 +23,19 @@ namespace biddingga {
 //   return genericga::multipop::GA<Environment>(sub_gas, env);
 // }
 
-std::vector<unsigned char> RandomByteArray(int n_bytes);
+std::vector<unsigned char> RandomByteArray(int n_bytes,
+                                           genericga::Philox4x32& gen);
 
+// Each genotype is drawn from its own substream of a fresh run-seeded stream.
 std::vector<genericga::binary::ByteArrayGenotype> RandomGenes(int pop_size,
                                                               int n_bytes);
 
+// Takes a seed=<n> argument out of argv, if there is one, and makes n the run
+// seed.  Returns the run seed either way, for the driver to record with its
+// output.  Call it before building any GA.  A seed= that is not a whole
+// uint64 is a usage error: it is reported on cerr and the program exits.
+std::uint64_t SeedFromArgs(int* argc, char** argv);
+
 }  // namespace biddingga
 
 #endif  // BIDDINGGA_HELPERS_H_
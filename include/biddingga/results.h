@@ -0,0 +1,95 @@
+#ifndef BIDDINGGA_RESULTS_H_
+#define BIDDINGGA_RESULTS_H_
+
+#include <condition_variable>
+#include <cstdint>
+#include <deque>
+#include <fstream>
+#include <istream>
+#include <mutex>
+#include <ostream>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include <eigen3/Eigen/Core>
+
+namespace biddingga {
+
+// The state of a run after some round, as named columns of values: e.g. each
+// player's bid function knots and the players' fitnesses.
+struct ResultsSnapshot {
+  int round = 0;
+  std::vector<std::string> names;
+  std::vector<std::vector<float>> columns;
+
+  void Add(std::string name, const Eigen::ArrayXd& values);
+  void Add(std::string name, std::vector<float> values);
+};
+
+// Results files start with the eight bytes "BGARES02" and the run seed as a
+// uint64, so a run can be repeated from its results.  Each snapshot follows
+// as an int32 round and an int32 column count, then per column an int32 name
+// length, the name, an int32 value count and the values as float32, all in
+// host byte order.  Single precision matches the six significant digits the
+// drivers used to print.
+void WriteResultsHeader(std::ostream& os, std::uint64_t seed);
+void WriteSnapshot(std::ostream& os, const ResultsSnapshot& snapshot);
+// False if the stream does not start with a results header.  Files from
+// before the seed was recorded, starting "BGARES01", read with a seed of 0.
+bool ReadResultsHeader(std::istream& is, std::uint64_t* seed = nullptr);
+// False at the end of the stream or on a truncated snapshot.
+bool ReadSnapshot(std::istream& is, ResultsSnapshot* snapshot);
+
+// The drivers' CSV layout: a line of comma separated values per column.
+void WriteSnapshotCSV(std::ostream& os, const ResultsSnapshot& snapshot);
+
+// Writes snapshots to a results file on a background thread through a large
+// buffer, so the GA never waits on the disk.  Drivers take a snapshot every
+// GetSnapshotFrequency() rounds, and should check IsOpen() before the run and
+// Flush() after it: a writer whose file could not be opened or written
+// accepts snapshots and drops them.
+class ResultsWriter {
+ public:
+  // seed is the run seed to record in the header.
+  explicit ResultsWriter(const std::string& path, int snapshot_frequency = 1,
+                         std::uint64_t seed = 0);
+  // Continues the file at path from a run resumed after resume_round, keeping
+  // its header and the snapshots up to that round and dropping any after it.
+  // Starts a new file recording seed if there is no readable one.
+  ResultsWriter(const std::string& path, int snapshot_frequency,
+                int resume_round, std::uint64_t seed = 0);
+  ~ResultsWriter();
+  ResultsWriter(const ResultsWriter&) = delete;
+  ResultsWriter& operator=(const ResultsWriter&) = delete;
+
+  // False if the file could not be opened, or kept up to the resumed round.
+  bool IsOpen() const { return open_; }
+  int GetSnapshotFrequency() const { return snapshot_frequency_; }
+  // Queues snapshot for writing.
+  void Write(ResultsSnapshot snapshot);
+  // Blocks until every queued snapshot is in the file.  False if any
+  // snapshot so far failed to reach it.
+  bool Flush();
+
+ private:
+  // False if the file cannot be opened or its header written.
+  bool Open(const std::string& path, bool append, std::uint64_t seed);
+  void Run();
+
+  int snapshot_frequency_;
+  std::vector<char> buffer_;
+  std::ofstream out_;
+  bool open_ = false;
+  std::mutex mutex_;
+  std::condition_variable queued_;
+  std::condition_variable written_;
+  std::deque<ResultsSnapshot> queue_;
+  bool writing_ = false;
+  bool done_ = false;
+  std::thread thread_;
+};
+
+}  // namespace biddingga
+
+#endif  // BIDDINGGA_RESULTS_H_
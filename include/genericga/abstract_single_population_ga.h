@@ -2,7 +2,9 @@
 #define GENERICGA_ABSTRACT_SINGLE_POPULATION_GA_H_
 
 #include <omp.h>
+#include <istream>
 #include <memory>
+#include <ostream>
 #include <vector>
 
 #include "genericga/children_factory.h"
@@ -37,6 +39,10 @@ class AbstractSinglePopulationGA {
   virtual std::vector<PhenotypeStrategy<Phen>> GetBestStrategies(int n) = 0;
   virtual PhenotypeStrategy<Phen> GetCommonestStrategy() = 0;
   virtual std::vector<PhenotypeStrategy<Phen>> GetCommonestStrategies(int n) = 0;
+  // Everything a resumed run needs to continue exactly: populations, random
+  // streams and selector state.  Loading expects a GA built the same way.
+  virtual void SaveCheckpoint(std::ostream& os) const = 0;
+  virtual void LoadCheckpoint(std::istream& is) = 0;
   virtual ~AbstractSinglePopulationGA() {}
 };
 
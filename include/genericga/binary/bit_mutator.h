@@ -1,27 +1,38 @@
 #ifndef GENERICGA_BINARY_BIT_MUTATOR_H_
 #define GENERICGA_BINARY_BIT_MUTATOR_H_
 
-#include <random>
+#include <vector>
 
 #include "genericga/binary/byte_array_genotype.h"
 #include "genericga/mutator.h"
+#include "genericga/random.h"
 
 namespace genericga {
 namespace binary {
 
+// Flips on average exp_bit_muts bits per genotype.  Individually, the number
+// of flips is Poisson and each flip picks a uniform bit.  With geometric_skip
+// set, MutateAll instead treats every child's bits as one bitstream, flips each
+// bit independently at rate exp_bit_muts / NBits, and jumps straight from one
+// flipped bit to the next with a geometric draw.  This needs one random number
+// per flip rather than two plus a Poisson draw per genotype.
 class BitMutator : public Mutator<ByteArrayGenotype> {
  public:
-  explicit BitMutator(float exp_bit_muts);
-  BitMutator(float exp_bit_muts, int seed);
-  void operator()(ByteArrayGenotype& gene) override;
+  explicit BitMutator(float exp_bit_muts, bool geometric_skip = false);
+  void operator()(ByteArrayGenotype& gene, Philox4x32& gen) const override;
+  void MutateAll(std::vector<ByteArrayGenotype>& genes,
+                 const Philox4x32& stream, int generation) const override;
 
  private:
-  std::mt19937 gen_;
-  std::poisson_distribution<> muts_dist_;
-  std::uniform_int_distribution<> bit_dist_;
-  int n_bits_ = 0;
+  float exp_bit_muts_;
+  bool geometric_skip_;
 };
 
+// Flips each bit across all of genes with probability bit_rate, in a single
+// pass over the flipped positions.
+void GeometricSkipFlip(std::vector<ByteArrayGenotype>& genes, double bit_rate,
+                       Philox4x32& gen);
+
 }  // namespace binary
 }  // namespace genericga
 
@@ -5,6 +5,8 @@
 
 #include <cassert>
 #include <climits>
+#include <istream>
+#include <ostream>
 #include <vector>
 
 #include "genericga/binary/float_encoding.h"
@@ -27,8 +29,14 @@ class ByteArrayGenotype {
   std::vector<int> ToIntArray(std::vector<IntEncoding> encodings) const;
   std::vector<float> ToFloatArray(std::vector<FloatEncoding> encodings) const;
   Eigen::ArrayXf ToEigenFloatArray(std::vector<FloatEncoding> encodings) const;
+  // The inverse of ToFloatArray: overwrites the leading bits with values,
+  // rounded to the nearest code and clamped to each encoding's range.
+  void SetFloatArray(const std::vector<float>& values,
+                     const std::vector<FloatEncoding>& encodings);
   unsigned int FromGrayCodeBits(int start_bit, int n_bits) const;
   unsigned int FromBits(int start_bit, int n_bits) const;
+  // Writes value into n_bits bits from start_bit, as FromBits reads them.
+  void SetBits(int start_bit, int n_bits, unsigned int value);
   friend void SwapBits(ByteArrayGenotype& gene1, ByteArrayGenotype& gene2,
                        int start_bit, int n_bits);
   unsigned char& operator[](int index) { return data_[index]; }
@@ -39,6 +47,8 @@ class ByteArrayGenotype {
   friend bool operator==(const ByteArrayGenotype& g1,
                          const ByteArrayGenotype& g2);
   friend std::size_t hash_value(const ByteArrayGenotype& s);
+  friend void WriteBinary(std::ostream& os, const ByteArrayGenotype& gene);
+  friend void ReadBinary(std::istream& is, ByteArrayGenotype* gene);
 
  private:
   std::vector<unsigned char> data_;
@@ -47,6 +57,7 @@ class ByteArrayGenotype {
 
 unsigned char FromSubByte(unsigned char byte, int start_bit, int n_bits);
 unsigned int GrayToBinary(unsigned int num);
+unsigned int BinaryToGray(unsigned int num);
 // Generates a 1-byte mask.  n_bits is the number of 1's (from the right).
 // Ex. GenerateMask(5) -> 00011111.
 unsigned char GenerateMask(const int n_bits);
@@ -0,0 +1,36 @@
+#ifndef GENERICGA_BINARY_FLOAT_LOCAL_SEARCH_H_
+#define GENERICGA_BINARY_FLOAT_LOCAL_SEARCH_H_
+
+#include <vector>
+
+#include "genericga/binary/byte_array_genotype.h"
+#include "genericga/binary/float_encoding.h"
+#include "genericga/local_search.h"
+
+namespace genericga {
+namespace binary {
+
+// Runs a CoordinateSearch on the floats a genotype encodes, writing each
+// candidate back into a copy of the genotype to score it.  Bits past the
+// encodings are kept from the starting genotype.
+class FloatLocalSearch {
+ public:
+  FloatLocalSearch(std::vector<FloatEncoding> encodings,
+                   int n_iterations = 5, double initial_step = 0.05);
+
+  std::vector<ByteArrayGenotype> operator()(
+      const ByteArrayGenotype& start,
+      const GenotypeFitness<ByteArrayGenotype>& fitness) const;
+
+ private:
+  ByteArrayGenotype Encode(const ByteArrayGenotype& base,
+                           const std::vector<double>& values) const;
+
+  std::vector<FloatEncoding> encodings_;
+  CoordinateSearch search_;
+};
+
+}  // namespace binary
+}  // namespace genericga
+
+#endif  // GENERICGA_BINARY_FLOAT_LOCAL_SEARCH_H_
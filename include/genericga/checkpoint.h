@@ -0,0 +1,127 @@
+#ifndef GENERICGA_CHECKPOINT_H_
+#define GENERICGA_CHECKPOINT_H_
+
+#include <cassert>
+#include <cstdint>
+#include <istream>
+#include <ostream>
+#include <stdexcept>
+#include <type_traits>
+#include <vector>
+
+#include <eigen3/Eigen/Core>
+
+namespace genericga {
+
+// Checkpoints are raw host-order bytes, for resuming a run with the same build
+// on the same kind of machine rather than for exchange.  Types that are not
+// trivially copyable get WriteBinary/ReadBinary overloads in their own
+// namespace, which the vector overloads find by argument-dependent lookup.
+//
+// Reads throw CheckpointError rather than return garbage when the stream
+// runs out or holds something other than what was saved.
+
+class CheckpointError : public std::runtime_error {
+ public:
+  using std::runtime_error::runtime_error;
+};
+
+inline void CheckRead(const std::istream& is) {
+  if (!is) {
+    throw CheckpointError("checkpoint is truncated or unreadable");
+  }
+}
+
+// Throws unless the rest of is can hold size elements of at least min_bytes
+// each, so a corrupt length fails here rather than in a huge allocation.
+// Streams that cannot seek are held to a fixed maximum instead.
+inline void CheckLength(std::istream& is, std::int64_t size,
+                        std::int64_t min_bytes) {
+  if (size < 0) {
+    throw CheckpointError("checkpoint has a negative length");
+  }
+  std::int64_t limit = (std::int64_t{1} << 32) / min_bytes;
+  std::istream::pos_type pos = is.tellg();
+  if (pos != std::istream::pos_type(-1)) {
+    is.seekg(0, std::istream::end);
+    std::istream::pos_type end = is.tellg();
+    is.seekg(pos);
+    CheckRead(is);
+    limit = (end - pos) / min_bytes;
+  }
+  if (size > limit) {
+    throw CheckpointError("checkpoint length runs past its end");
+  }
+}
+
+template <class T>
+void WriteBinary(std::ostream& os, const std::vector<T>& values);
+template <class T>
+void ReadBinary(std::istream& is, std::vector<T>* values);
+inline void WriteBinary(std::ostream& os, const Eigen::ArrayXd& values);
+inline void ReadBinary(std::istream& is, Eigen::ArrayXd* values);
+
+template <class T>
+void WriteBinary(std::ostream& os, const T& value) {
+  static_assert(std::is_trivially_copyable<T>::value,
+                "WriteBinary needs an overload for this type.");
+  os.write(reinterpret_cast<const char*>(&value), sizeof(value));
+}
+
+template <class T>
+void ReadBinary(std::istream& is, T* value) {
+  static_assert(std::is_trivially_copyable<T>::value,
+                "ReadBinary needs an overload for this type.");
+  is.read(reinterpret_cast<char*>(value), sizeof(*value));
+  CheckRead(is);
+}
+
+template <class T>
+void WriteBinary(std::ostream& os, const std::vector<T>& values) {
+  WriteBinary(os, static_cast<std::int64_t>(values.size()));
+  if constexpr (std::is_trivially_copyable<T>::value) {
+    os.write(reinterpret_cast<const char*>(values.data()),
+             values.size() * sizeof(T));
+  } else {
+    for (const auto& value : values) {
+      WriteBinary(os, value);
+    }
+  }
+}
+
+template <class T>
+void ReadBinary(std::istream& is, std::vector<T>* values) {
+  std::int64_t size;
+  ReadBinary(is, &size);
+  // Every element takes at least a byte, whatever its type.
+  CheckLength(is, size,
+              std::is_trivially_copyable<T>::value ? sizeof(T) : 1);
+  values->resize(size);
+  if constexpr (std::is_trivially_copyable<T>::value) {
+    is.read(reinterpret_cast<char*>(values->data()), size * sizeof(T));
+    CheckRead(is);
+  } else {
+    for (auto& value : *values) {
+      ReadBinary(is, &value);
+    }
+  }
+}
+
+inline void WriteBinary(std::ostream& os, const Eigen::ArrayXd& values) {
+  WriteBinary(os, static_cast<std::int64_t>(values.size()));
+  os.write(reinterpret_cast<const char*>(values.data()),
+           values.size() * sizeof(double));
+}
+
+inline void ReadBinary(std::istream& is, Eigen::ArrayXd* values) {
+  std::int64_t size;
+  ReadBinary(is, &size);
+  CheckLength(is, size, sizeof(double));
+  values->resize(size);
+  is.read(reinterpret_cast<char*>(values->data()), size * sizeof(double));
+  CheckRead(is);
+}
+
+}  // namespace genericga
+
+#endif  // GENERICGA_CHECKPOINT_H_
@@ -2,13 +2,18 @@
 #define GENERICGA_CHILDREN_FACTORY_H_
 
 #include <iostream>
+#include <istream>
 #include <memory>
+#include <ostream>
 #include <utility>
 #include <vector>
 
+#include "genericga/checkpoint.h"
 #include "genericga/crossover.h"
 #include "genericga/genotype_population.h"
 #include "genericga/mutator.h"
+#include "genericga/profile.h"
+#include "genericga/random.h"
 #include "genericga/selector.h"
 #include "genericga/selector/tournament.h"
 #include "genericga/selector/ranked_weighted.h"
@@ -16,7 +21,10 @@
 namespace genericga {
 
 // Generates new genotypes (children) by performing selection, crossover, and
-// mutation on a population.
+// mutation on a population.  Each crossover pair draws from its own
+// (generation, index) substream, and mutators are handed the generation so they
+// can do likewise, so children are identical no matter how many threads
+// produce them.
 template <class Gen>
 class ChildrenFactory {
  public:
@@ -26,6 +34,13 @@ class ChildrenFactory {
                   std::make_unique<selector::RankedWeighted>(0.6));
   std::vector<Gen> GetChildren(const GenotypePopulation<Gen>& pop_,
                                int n_children_);
+  // Records parent selection, crossover and mutation times into log.
+  void SetProfileLog(std::shared_ptr<ProfileLog> log) {
+    profile_log_ = std::move(log);
+  }
+  // The random streams, generation and parent selector state.
+  void SaveCheckpoint(std::ostream& os) const;
+  void LoadCheckpoint(std::istream& is);
 
  private:
   // Pairs up adjacent parents, and conducts crossover.  If odd # of parents,
@@ -36,6 +51,10 @@ class ChildrenFactory {
   std::unique_ptr<Crossover<Gen>> crossover_;
   std::unique_ptr<Mutator<Gen>> mutator_;
   std::unique_ptr<Selector> parent_selector_;
+  Philox4x32 crossover_rng_;
+  Philox4x32 mutation_rng_;
+  int generation_ = 0;
+  std::shared_ptr<ProfileLog> profile_log_;
 };
 
 template <class Gen>
@@ -44,31 +63,68 @@ ChildrenFactory<Gen>::ChildrenFactory(std::unique_ptr<Crossover<Gen>> crossover,
                                       std::unique_ptr<Selector> parent_selector)
     : crossover_(std::move(crossover)),
       mutator_(std::move(mutator)),
-      parent_selector_(std::move(parent_selector)) {}
+      parent_selector_(std::move(parent_selector)),
+      crossover_rng_(MakeStream()),
+      mutation_rng_(MakeStream()) {}
 
 template <class Gen>
 std::vector<Gen> ChildrenFactory<Gen>::GetChildren(
     const GenotypePopulation<Gen>& pop, int n_children) {
-  auto children = pop.SelectGenotypes(*parent_selector_, n_children);
-  ConductCrossover(children);
-  ConductMutation(children);
+  ProfileLog* log = profile_log_.get();
+  std::vector<Gen> children;
+  {
+    PhaseTimer timer(log, "parent_selection");
+    auto parents = pop.SelectParentIndices(*parent_selector_, n_children);
+    // Parents are copied straight into the child buffer, which crossover and
+    // mutation then modify in place.
+    children.reserve(parents.size());
+    for (int ind : parents) {
+      children.push_back(pop.GetGenotype(ind));
+    }
+  }
+  ProfileCount(log, "genotype_copies", children.size());
+  {
+    PhaseTimer timer(log, "crossover");
+    ConductCrossover(children);
+  }
+  {
+    PhaseTimer timer(log, "mutation");
+    ConductMutation(children);
+  }
+  ++generation_;
   return children;
 }
 
+template <class Gen>
+void ChildrenFactory<Gen>::SaveCheckpoint(std::ostream& os) const {
+  WriteBinary(os, crossover_rng_);
+  WriteBinary(os, mutation_rng_);
+  WriteBinary(os, generation_);
+  parent_selector_->SaveCheckpoint(os);
+}
+
+template <class Gen>
+void ChildrenFactory<Gen>::LoadCheckpoint(std::istream& is) {
+  ReadBinary(is, &crossover_rng_);
+  ReadBinary(is, &mutation_rng_);
+  ReadBinary(is, &generation_);
+  parent_selector_->LoadCheckpoint(is);
+}
+
 template <class Gen>
 void ChildrenFactory<Gen>::ConductCrossover(std::vector<Gen>& children) {
-  // Gotta stop one before the end since we use i+1 as the neighboring
-  // geneotype.
-  for (int i = 0; i < children.size() - 1; i += 2) {
-    (*crossover_)(children[i], children[i + 1]);
+  // Pair i is children 2i and 2i+1; an odd child out is left alone.
+  int n_pairs = children.size() / 2;
+#pragma omp parallel for
+  for (int i = 0; i < n_pairs; ++i) {
+    auto rng = crossover_rng_.Substream(generation_, i);
+    (*crossover_)(children[2 * i], children[2 * i + 1], rng);
   }
 }
 
 template <class Gen>
 void ChildrenFactory<Gen>::ConductMutation(std::vector<Gen>& children) {
-  for (auto& child : children) {
-    (*mutator_)(child);
-  }
+  mutator_->MutateAll(children, mutation_rng_, generation_);
 }
 
 }  // namespace genericga
@@ -1,14 +1,19 @@
 #ifndef GENERICGA_COMPOSITE_GA_H_
 #define GENERICGA_COMPOSITE_GA_H_
 
+#include <istream>
 #include <memory>
+#include <ostream>
+#include <string>
 #include <vector>
 
 #include "genericga/abstract_single_population_ga.h"
+#include "genericga/parallel.h"
 #include "genericga/phenotype_strategy.h"
 #include "genericga/selector.h"
 #include "genericga/selector/keep_best.h"
 #include "genericga/selector/keep_commonest.h"
+#include "genericga/trace.h"
 
 namespace genericga {
 
@@ -25,17 +30,33 @@ class CompositeGA : public AbstractSinglePopulationGA<Phen> {
         best_sel_(),
         commonest_sel_() {}
 
+  // Components are independent populations that only share the read-only
+  // fitness calculator, so they evolve concurrently.  Each owns its own random
+  // streams, so the result does not depend on the thread count.
   void RunRound(int n) override {
-    for (auto& ga : gas_) {
-      ga->RunRound(n);
-    }
+    ParallelFor(gas_.size(), [this, n](int i) {
+      TraceSpan span("composite_", i);
+      gas_[i]->RunRound(n);
+    });
   };
+
+  // The first component is evaluated on the calling thread, so environments
+  // that precalculate lazily on their first GetFitness call have done so before
+  // any concurrent reads.
   void SetFitnessCalculator(
       std::function<std::vector<float>(const std::vector<Phen>&)> fit_calc)
       override {
-    for (auto& ga : gas_) {
-      ga->SetFitnessCalculator(fit_calc);
+    if (gas_.empty()) {
+      return;
+    }
+    {
+      TraceSpan span("composite_0_fitness");
+      gas_[0]->SetFitnessCalculator(fit_calc);
     }
+    ParallelFor(gas_.size() - 1, [this, &fit_calc](int i) {
+      TraceSpan span("composite_", i + 1, "_fitness");
+      gas_[i + 1]->SetFitnessCalculator(fit_calc);
+    });
   }
 
   PhenotypeStrategy<Phen> SelectStrategy(Selector& sel) override {
@@ -81,6 +102,18 @@ class CompositeGA : public AbstractSinglePopulationGA<Phen> {
     return SelectStrategies(commonest_sel_, n);
   }
 
+  void SaveCheckpoint(std::ostream& os) const override {
+    for (const auto& ga : gas_) {
+      ga->SaveCheckpoint(os);
+    }
+  }
+
+  void LoadCheckpoint(std::istream& is) override {
+    for (auto& ga : gas_) {
+      ga->LoadCheckpoint(is);
+    }
+  }
+
  private:
   std::vector<std::shared_ptr<AbstractSinglePopulationGA<Phen>>> gas_;
   std::function<PhenotypeStrategy<Phen>(
@@ -1,13 +1,16 @@
 #ifndef GENERICGA_CROSSOVER_H_
 #define GENERICGA_CROSSOVER_H_
 
+#include "genericga/random.h"
+
 namespace genericga {
 
-//  Mixes two genotypes together.
+//  Mixes two genotypes together.  Like Mutator, all randomness comes from gen.
 template <class Gen>
 class Crossover {
  public:
-  virtual void operator()(Gen& genotype1, Gen& genotype2) = 0;
+  virtual void operator()(Gen& genotype1, Gen& genotype2,
+                          Philox4x32& gen) const = 0;
   virtual ~Crossover() {}
 };
 }  // namespace genericga
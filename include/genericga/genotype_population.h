@@ -15,6 +15,9 @@ class GenotypePopulation {
   virtual std::vector<Gen> GetGenotypes() const = 0;
   virtual Gen SelectGenotype(Selector& selector) const = 0;
   virtual std::vector<Gen> SelectGenotypes(Selector& selector, int n) const = 0;
+  virtual std::vector<int> SelectParentIndices(Selector& selector,
+                                               int n) const = 0;
+  virtual const Gen& GetGenotype(int index) const = 0;
   virtual std::vector<float> GetFitnesses() const = 0;
 };
 
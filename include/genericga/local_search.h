@@ -0,0 +1,44 @@
+#ifndef GENERICGA_LOCAL_SEARCH_H_
+#define GENERICGA_LOCAL_SEARCH_H_
+
+#include <functional>
+#include <vector>
+
+namespace genericga {
+
+// Scores genotypes against the population's current fitness calculator.
+template <class Gen>
+using GenotypeFitness =
+    std::function<std::vector<float>(const std::vector<Gen>&)>;
+
+// Improves on a genotype using only fitness evaluations.  Returns the
+// genotypes to add to the population, which may be none.
+template <class Gen>
+using LocalSearch =
+    std::function<std::vector<Gen>(const Gen&, const GenotypeFitness<Gen>&)>;
+
+// Pattern search over a box.  Each iteration scores a step up and down along
+// every coordinate in one batch, then the sum of the improving steps, and
+// moves to the best of them.  The step halves when nothing improves.
+// Usable directly as a LocalSearch<std::vector<double>>.
+class CoordinateSearch {
+ public:
+  // initial_step is a fraction of each coordinate's range.
+  CoordinateSearch(std::vector<double> mins, std::vector<double> maxs,
+                   int n_iterations = 5, double initial_step = 0.05);
+
+  // The best point found, or nothing if no point beat start.
+  std::vector<std::vector<double>> operator()(
+      const std::vector<double>& start,
+      const GenotypeFitness<std::vector<double>>& fitness) const;
+
+ private:
+  std::vector<double> mins_;
+  std::vector<double> maxs_;
+  int n_iterations_;
+  double initial_step_;
+};
+
+}  // namespace genericga
+
+#endif  // GENERICGA_LOCAL_SEARCH_H_
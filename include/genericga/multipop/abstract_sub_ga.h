@@ -1,8 +1,12 @@
 #ifndef GENERICGA_MULTIPOP_ABSTRACT_SUB_GA_H_
 #define GENERICGA_MULTIPOP_ABSTRACT_SUB_GA_H_
 
+#include <istream>
+#include <ostream>
 #include <vector>
 
+#include "genericga/multipop/convergence.h"
+
 namespace genericga {
 namespace multipop {
 
@@ -10,7 +14,14 @@ template <class Environment>
 class AbstractSubGA {
  public:
   virtual void RunRound(const std::vector<Environment*>& envs) = 0;
+  // As above, for environments shared with other threads.
+  virtual void RunRound(const std::vector<const Environment*>& envs) = 0;
   virtual void SubmitPlayStrat(Environment& env) = 0;
+  virtual void SaveCheckpoint(std::ostream& os) const = 0;
+  virtual void LoadCheckpoint(std::istream& is) = 0;
+  // How the best strategy moved in the last RunRound.  Only measured while
+  // change tracking is on, since it costs extra fitness evaluations.
+  virtual StrategyChange GetLastChange() const = 0;
   virtual ~AbstractSubGA() {}
   
   void SubmitPlayStrats(std::vector<Environment*>& envs) {
@@ -21,6 +32,8 @@ class AbstractSubGA {
   int GetID() const { return id_; }
   int GetPriority() const { return priority_; }
   void SetPriority(int priority) { priority_ = priority; }
+  bool GetTrackChanges() const { return track_changes_; }
+  void SetTrackChanges(bool track) { track_changes_ = track; }
 
  protected:
     explicit AbstractSubGA(int id, int priority = 0)
@@ -28,6 +41,7 @@ class AbstractSubGA {
  private:
   int id_;
   int priority_;
+  bool track_changes_ = false;
 };
 
 }  // namespace multipop
@@ -0,0 +1,98 @@
+#ifndef GENERICGA_MULTIPOP_CONVERGENCE_H_
+#define GENERICGA_MULTIPOP_CONVERGENCE_H_
+
+#include <cmath>
+#include <functional>
+#include <limits>
+#include <type_traits>
+#include <utility>
+
+#include <eigen3/Eigen/Core>
+
+namespace genericga {
+namespace multipop {
+
+// How a sub-GA's best strategy moved over its last round.  The strategy
+// distances compare its values (see StrategyValues) before and after the
+// round and are infinite if the two cannot be compared.  fitness_change is
+// the new best's fitness less the old best's, both scored against the round's
+// environments.  It is not a best-response gap: it only says how much better
+// the round's search did than the strategy it started from, and stays near
+// zero whenever the GA stalls, even far from a best response.  Everything is
+// infinite until a round has been measured.
+struct StrategyChange {
+  double strategy_linf = std::numeric_limits<double>::infinity();
+  double strategy_l2 = std::numeric_limits<double>::infinity();
+  double fitness_change = std::numeric_limits<double>::infinity();
+};
+
+// A run has converged once every sub-GA's best strategy has moved by at most
+// strategy_tolerance (L-infinity) and changed fitness by at most
+// fitness_tolerance, either way, in each of the last patience rounds.  If
+// best_response_gap is set, the run must then also be within gap_tolerance
+// of equilibrium.
+struct ConvergenceCriteria {
+  double strategy_tolerance = 0;
+  // Bounds StrategyChange::fitness_change, the round-on-round improvement of
+  // the best strategy, not its distance from a best response.
+  double fitness_tolerance = 0;
+  int patience = 1;
+  // The most any player could gain by switching from its current best
+  // strategy to a best response, for environments that can compute one (see
+  // auctions::MakeBestResponseGap).  It is only called in the round the
+  // other criteria reach patience, since it is usually far costlier than a
+  // round; a gap above gap_tolerance restarts the count of stable rounds.
+  std::function<double()> best_response_gap;
+  double gap_tolerance = 0;
+
+  bool IsStable(const StrategyChange& change) const {
+    return change.strategy_linf <= strategy_tolerance &&
+           std::abs(change.fitness_change) <= fitness_tolerance;
+  }
+};
+
+// The values of a phenotype that convergence compares between rounds.
+// Phenotypes from other libraries overload StrategyValues in their own
+// namespace.  Phenotypes without an overload cannot be measured, so their
+// sub-GAs never count as stable.
+template <class T, std::enable_if_t<std::is_arithmetic_v<T>, int> = 0>
+Eigen::ArrayXd StrategyValues(T value) {
+  return Eigen::ArrayXd::Constant(1, value);
+}
+inline Eigen::ArrayXd StrategyValues(const Eigen::ArrayXd& values) {
+  return values;
+}
+
+template <class T, class = void>
+struct HasStrategyValues : std::false_type {};
+
+template <class T>
+struct HasStrategyValues<
+    T, std::void_t<decltype(StrategyValues(std::declval<const T&>()))>>
+    : std::true_type {};
+
+// Fills in the strategy distances of change.
+template <class Phen>
+void MeasureStrategyChange(const Phen& before, const Phen& after,
+                           StrategyChange* change) {
+  if constexpr (HasStrategyValues<Phen>::value) {
+    Eigen::ArrayXd before_values = StrategyValues(before);
+    Eigen::ArrayXd after_values = StrategyValues(after);
+    if (before_values.size() != after_values.size()) {
+      change->strategy_linf = std::numeric_limits<double>::infinity();
+      change->strategy_l2 = std::numeric_limits<double>::infinity();
+      return;
+    }
+    Eigen::ArrayXd diffs = (after_values - before_values).abs();
+    change->strategy_linf = diffs.size() == 0 ? 0 : diffs.maxCoeff();
+    change->strategy_l2 = std::sqrt(diffs.square().sum());
+  } else {
+    change->strategy_linf = std::numeric_limits<double>::infinity();
+    change->strategy_l2 = std::numeric_limits<double>::infinity();
+  }
+}
+
+}  // namespace multipop
+}  // namespace genericga
+
+#endif  // GENERICGA_MULTIPOP_CONVERGENCE_H_
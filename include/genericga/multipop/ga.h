@@ -2,26 +2,77 @@
 #define GENERICGA_MULTIPOP_GA_H_
 
 #include <algorithm>
+#include <cassert>
+#include <condition_variable>
+#include <cstdio>
+#include <cstring>
+#include <fstream>
+#include <istream>
 #include <memory>
+#include <mutex>
 #include <numeric>
+#include <optional>
+#include <ostream>
 #include <random>
 #include <set>
+#include <stdexcept>
+#include <string>
+#include <thread>
+#include <type_traits>
 #include <utility>
 #include <vector>
 #include <iostream>
 
+#include "genericga/checkpoint.h"
 #include "genericga/multipop/abstract_sub_ga.h"
+#include "genericga/multipop/convergence.h"
+#include "genericga/multipop/snapshot_buffer.h"
+#include "genericga/parallel.h"
+#include "genericga/profile.h"
+#include "genericga/random.h"
+#include "genericga/trace.h"
 
 namespace genericga {
 namespace multipop {
 
+// Detects environments with a public Precalculate() for their lazily built
+// state.
+template <class T, class = void>
+struct HasPrecalculate : std::false_type {};
+
+template <class T>
+struct HasPrecalculate<
+    T, std::void_t<decltype(std::declval<const T&>().Precalculate())>>
+    : std::true_type {};
+
+// Detects environments with a static Mix() that folds a batch of environments
+// into one.
+template <class T, class = void>
+struct HasMix : std::false_type {};
+
+template <class T>
+struct HasMix<T, std::void_t<decltype(T::Mix(
+                     std::declval<const std::vector<T*>&>()))>>
+    : std::true_type {};
+
+// Detects environments that can save and restore their accepted strategies.
+template <class T, class = void>
+struct HasCheckpoint : std::false_type {};
+
+template <class T>
+struct HasCheckpoint<
+    T, std::void_t<decltype(std::declval<const T&>().SaveCheckpoint(
+                       std::declval<std::ostream&>())),
+                   decltype(std::declval<T&>().LoadCheckpoint(
+                       std::declval<std::istream&>()))>> : std::true_type {};
+
 template <class Environment>
 class GA {
  public:
   GA(std::vector<std::shared_ptr<AbstractSubGA<Environment>>> gas,
      Environment env, int batch_size = 1, int max_memory = 1)
       : gas_(std::move(gas)),
-        gen_(std::random_device()()),
+        gen_(MakeStream()),
         batch_size_(batch_size),
         memory_(max_memory, env),
         max_memory_size_(max_memory),
@@ -39,6 +90,226 @@ class GA {
     }
   }
 
+  // Opt-in fictitious-play mode.  When more than one environment is sampled,
+  // they are folded into a single Environment::Mix environment and each
+  // phenotype is scored once against it, rather than once per environment.
+  void SetMixEnvironments(bool mix) {
+    static_assert(HasMix<Environment>::value,
+                  "Mixing requires a static Environment::Mix.");
+    mix_environments_ = mix;
+  }
+
+  // Time per priority tier ("tier_<priority>") and per sub-GA
+  // ("sub_ga_<index>") for each synchronous round.  Empty unless built with
+  // GENERICGA_PROFILE.
+  const ProfileLog& GetProfileLog() const { return profile_; }
+
+  // Rounds run so far, including those restored from a checkpoint.
+  int GetRoundCount() const { return round_count_; }
+
+  // Turns on change tracking in every sub-GA and, from then on, counts the
+  // consecutive synchronous rounds in which all of them were stable under
+  // criteria.  RunRoundAsync leaves the count alone.
+  void SetConvergenceCriteria(ConvergenceCriteria criteria) {
+    assert(criteria.patience > 0);
+    criteria_ = criteria;
+    for (auto& ga : gas_) {
+      ga->SetTrackChanges(true);
+    }
+  }
+  // Each sub-GA's change over the last round, in sub-GA order.
+  std::vector<StrategyChange> GetLastChanges() const {
+    std::vector<StrategyChange> changes;
+    for (const auto& ga : gas_) {
+      changes.push_back(ga->GetLastChange());
+    }
+    return changes;
+  }
+  int GetStableRoundCount() const { return stable_rounds_; }
+  bool HasConverged() const {
+    return criteria_ && stable_rounds_ >= criteria_->patience;
+  }
+  // Runs rounds until the run has converged or GetRoundCount() reaches
+  // max_rounds, and returns whether it converged.
+  bool RunUntilConverged(int max_rounds) {
+    assert(criteria_);
+    while (!HasConverged() && round_count_ < max_rounds) {
+      RunSingleRound();
+    }
+    return HasConverged();
+  }
+
+  // A checkpoint holds the driver's random stream, the environment memory with
+  // every accepted strategy, and each sub-GA's populations and random streams.
+  // Loading one into a GA built the same way continues the saved run exactly
+  // as it would have gone on.  LoadCheckpoint throws CheckpointError on a
+  // truncated checkpoint or one from a differently built GA, after which
+  // this GA is only fit to be destroyed.
+  void SaveCheckpoint(std::ostream& os) const {
+    static_assert(HasCheckpoint<Environment>::value,
+                  "Checkpoints require Environment::SaveCheckpoint.");
+    os.write(kCheckpointMagic, kCheckpointMagicSize);
+    WriteBinary(os, round_count_);
+    WriteBinary(os, stable_rounds_);
+    WriteBinary(os, gen_);
+    WriteBinary(os, cur_memory_size_);
+    WriteBinary(os, mem_index_);
+    WriteBinary(os, static_cast<int>(memory_.size()));
+    for (const auto& env : memory_) {
+      env.SaveCheckpoint(os);
+    }
+    WriteBinary(os, static_cast<int>(gas_.size()));
+    for (const auto& ga : gas_) {
+      ga->SaveCheckpoint(os);
+    }
+  }
+  void LoadCheckpoint(std::istream& is) {
+    static_assert(HasCheckpoint<Environment>::value,
+                  "Checkpoints require Environment::LoadCheckpoint.");
+    char magic[kCheckpointMagicSize];
+    is.read(magic, kCheckpointMagicSize);
+    CheckRead(is);
+    if (std::memcmp(magic, kCheckpointMagic, sizeof(magic)) != 0) {
+      throw CheckpointError("not a checkpoint of this version");
+    }
+    ReadBinary(is, &round_count_);
+    ReadBinary(is, &stable_rounds_);
+    ReadBinary(is, &gen_);
+    ReadBinary(is, &cur_memory_size_);
+    ReadBinary(is, &mem_index_);
+    int size;
+    ReadBinary(is, &size);
+    if (size != static_cast<int>(memory_.size())) {
+      throw CheckpointError("checkpoint memory size differs");
+    }
+    for (auto& env : memory_) {
+      env.LoadCheckpoint(is);
+    }
+    ReadBinary(is, &size);
+    if (size != static_cast<int>(gas_.size())) {
+      throw CheckpointError("checkpoint sub-GA count differs");
+    }
+    for (auto& ga : gas_) {
+      ga->LoadCheckpoint(is);
+    }
+  }
+
+  // Writes to a temporary file first, so a run killed mid-write leaves the
+  // previous checkpoint intact.  Throws CheckpointError, again leaving the
+  // previous checkpoint, if the file cannot be written or moved into place.
+  void SaveCheckpointFile(const std::string& path) const {
+    std::string tmp_path = path + ".tmp";
+    std::ofstream out(tmp_path, std::ofstream::binary);
+    if (out) {
+      SaveCheckpoint(out);
+      out.close();
+    }
+    if (!out) {
+      std::remove(tmp_path.c_str());
+      throw CheckpointError("cannot write checkpoint " + tmp_path);
+    }
+    if (std::rename(tmp_path.c_str(), path.c_str()) != 0) {
+      std::remove(tmp_path.c_str());
+      throw CheckpointError("cannot move checkpoint into " + path);
+    }
+  }
+  // False, leaving the GA untouched, if there is no file at path.  Throws
+  // CheckpointError as LoadCheckpoint does if the file is not a usable
+  // checkpoint.
+  bool LoadCheckpointFile(const std::string& path) {
+    std::ifstream in(path, std::ifstream::binary);
+    if (!in) {
+      return false;
+    }
+    LoadCheckpoint(in);
+    return true;
+  }
+
+  // Saves a checkpoint to path after every frequency rounds of RunRound, which
+  // then throws CheckpointError if the save fails.
+  void SetCheckpointFile(std::string path, int frequency) {
+    static_assert(HasCheckpoint<Environment>::value,
+                  "Checkpoints require Environment::SaveCheckpoint.");
+    assert(frequency > 0);
+    checkpoint_path_ = std::move(path);
+    checkpoint_frequency_ = frequency;
+  }
+
+  // Pipelined co-evolution: every sub-GA runs n rounds on its own thread with
+  // no barrier between rounds.  Each round evolves against the latest
+  // published environment and then publishes the sub-GA's play strategy as a
+  // new version of it, so fast sub-GAs never wait on slow ones unless they get
+  // more than max_staleness rounds ahead of the slowest.  Priorities,
+  // batch_size and memory are ignored while running.  Results depend on thread
+  // timing, so runs are not reproducible even with a fixed run seed; the first
+  // call in a process says so on stderr.  Throws std::invalid_argument if
+  // max_staleness is negative, which would leave every sub-GA waiting.
+  void RunRoundAsync(int n, int max_staleness = 1) {
+    if (max_staleness < 0) {
+      throw std::invalid_argument("max_staleness must not be negative");
+    }
+    if (gas_.empty()) {
+      return;
+    }
+    static std::once_flag warned;
+    std::call_once(warned, [] {
+      std::cerr << "Warning: asynchronous co-evolution is not deterministic; "
+                   "results depend on thread timing."
+                << std::endl;
+    });
+    int last_index = (mem_index_ + max_memory_size_ - 1) % max_memory_size_;
+    PrecalculateEnvironment(memory_[last_index]);
+    SnapshotBuffer<Environment> latest(memory_[last_index]);
+
+    int n_gas = gas_.size();
+    // The workers are not OpenMP threads, so each ParallelFor inside a sub-GA
+    // opens its own team.  Splitting the thread budget between them keeps the
+    // total near what a synchronous round would use.
+    int threads_per_ga = std::max(1, omp_get_max_threads() / n_gas);
+    std::vector<int> rounds_done(n_gas, 0);
+    std::mutex progress_mutex;
+    std::condition_variable progress;
+    auto run_sub_ga = [&](int g) {
+      omp_set_num_threads(threads_per_ga);
+      for (int round = 0; round < n; ++round) {
+        {
+          std::unique_lock<std::mutex> lock(progress_mutex);
+          progress.wait(lock, [&] {
+            return round - *std::min_element(rounds_done.begin(),
+                                             rounds_done.end()) <=
+                   max_staleness;
+          });
+        }
+        TraceSpan span("sub_ga_", g);
+        // Snapshots are precalculated before they are published, so scoring
+        // against one never needs to modify it.
+        auto snapshot = latest.Load();
+        std::vector<const Environment*> envs{&snapshot->value};
+        gas_[g]->RunRound(envs);
+        latest.Update([this, g](Environment& env) {
+          gas_[g]->SubmitPlayStrat(env);
+          PrecalculateEnvironment(env);
+        });
+        {
+          std::lock_guard<std::mutex> lock(progress_mutex);
+          ++rounds_done[g];
+        }
+        progress.notify_all();
+      }
+    };
+    std::vector<std::thread> threads;
+    for (int g = 0; g < n_gas; ++g) {
+      threads.emplace_back(run_sub_ga, g);
+    }
+    for (auto& thread : threads) {
+      thread.join();
+    }
+
+    memory_[mem_index_] = latest.Load()->value;
+    IncrementMemory();
+    round_count_ += n;
+  }
+
  private:
   void IncrementMemory() {
     if (cur_memory_size_ < max_memory_size_) {
@@ -47,7 +318,10 @@ class GA {
     mem_index_ = (mem_index_ + 1) % max_memory_size_;
   }
   void RunSingleRound() {
-    std::vector<int> priorities(gas_.size());
+    ProfileLog* log = kProfileEnabled ? &profile_ : nullptr;
+    TraceSpan round_span("round");
+    std::vector<int> priorities;
+    priorities.reserve(gas_.size());
     std::transform(gas_.begin(), gas_.end(), std::back_inserter(priorities),
                    [](const std::shared_ptr<AbstractSubGA<Environment>>& ga) {
                      return ga->GetPriority();
@@ -71,31 +345,120 @@ class GA {
     // Smaller priority moves first.  This can be useful when coordination is
     // required.
     for (auto p : unique_priorities) {
-      // Update population.  (e.g. survey the environments and consider possible
-      // moves)
-      for (auto& ga : gas_) {
-        if (ga->GetPriority() == p) {
-          ga->RunRound(sel_envs);
+      // Only named when profiling, to keep the string off the hot path.
+      std::string tier_name = log ? "tier_" + std::to_string(p) : "";
+      PhaseTimer tier_timer(log, tier_name.c_str());
+      TraceSpan tier_span("tier_", p);
+      std::vector<AbstractSubGA<Environment>*> tier;
+      std::vector<int> tier_indices;
+      for (int g = 0; g < static_cast<int>(gas_.size()); ++g) {
+        if (gas_[g]->GetPriority() == p) {
+          tier.push_back(gas_[g].get());
+          tier_indices.push_back(g);
         }
       }
+      // Update population.  (e.g. survey the environments and consider possible
+      // moves)  GAs in a tier only read the environments, so they run
+      // concurrently once any lazy precalculation is done.
+      std::optional<Environment> mixed_env;
+      std::vector<Environment*> tier_envs = sel_envs;
+      if (mix_environments_ && sel_envs.size() > 1) {
+        PhaseTimer timer(log, "mix");
+        mixed_env.emplace(MixEnvironments(sel_envs));
+        tier_envs = {&*mixed_env};
+      }
+      {
+        PhaseTimer timer(log, "precalculate");
+        PrecalculateEnvironments(tier_envs);
+      }
+      // The sub-GAs run on other threads, so their times are recorded here
+      // and added to the log after the join.
+      std::vector<ProfileLog> sub_logs(log ? tier.size() : 0);
+      ParallelFor(tier.size(), [&](int i) {
+        PhaseTimer timer(log ? &sub_logs[i] : nullptr, "sub_ga");
+        TraceSpan span("sub_ga_", tier_indices[i]);
+        tier[i]->RunRound(tier_envs);
+      });
+      for (int i = 0; i < static_cast<int>(sub_logs.size()); ++i) {
+        profile_.AddTime("sub_ga_" + std::to_string(tier_indices[i]),
+                         sub_logs[i].GetTime(0, "sub_ga"));
+      }
+      ProfileCount(log, "environments", tier_envs.size());
 
-      // Play strategy into each environment
-      for (auto& ga : gas_) {
-        if (ga->GetPriority() == p) {
-          ga->SubmitPlayStrat(memory_[mem_index_]);
-        }
+      // Play strategy into each environment, in sub-GA order.
+      PhaseTimer timer(log, "submit");
+      for (auto ga : tier) {
+        ga->SubmitPlayStrat(memory_[mem_index_]);
       }
     }
+    if (log) {
+      profile_.NextGeneration();
+    }
     IncrementMemory();
+    ++round_count_;
+    if (criteria_) {
+      bool stable = std::all_of(
+          gas_.begin(), gas_.end(),
+          [this](const std::shared_ptr<AbstractSubGA<Environment>>& ga) {
+            return criteria_->IsStable(ga->GetLastChange());
+          });
+      stable_rounds_ = stable ? stable_rounds_ + 1 : 0;
+      if (stable_rounds_ == criteria_->patience &&
+          criteria_->best_response_gap) {
+        // Written so that a NaN gap also fails.
+        double gap = criteria_->best_response_gap();
+        if (!(gap <= criteria_->gap_tolerance)) {
+          stable_rounds_ = 0;
+        }
+      }
+    }
+    if constexpr (HasCheckpoint<Environment>::value) {
+      if (!checkpoint_path_.empty() &&
+          round_count_ % checkpoint_frequency_ == 0) {
+        SaveCheckpointFile(checkpoint_path_);
+      }
+    }
   }
 
-  std::mt19937 gen_;
+  Environment MixEnvironments(const std::vector<Environment*>& envs) {
+    if constexpr (HasMix<Environment>::value) {
+      return Environment::Mix(envs);
+    } else {
+      return *envs[0];
+    }
+  }
+  void PrecalculateEnvironment(const Environment& env) {
+    if constexpr (HasPrecalculate<Environment>::value) {
+      TraceSpan span("Precalculate");
+      env.Precalculate();
+    }
+  }
+  void PrecalculateEnvironments(const std::vector<Environment*>& envs) {
+    for (auto env : envs) {
+      PrecalculateEnvironment(*env);
+    }
+  }
+
+  static constexpr char kCheckpointMagic[] = "BGACKP03";
+  static constexpr int kCheckpointMagicSize = sizeof(kCheckpointMagic) - 1;
+
+  Philox4x32 gen_;
   std::vector<std::shared_ptr<AbstractSubGA<Environment>>> gas_;
+  // Full copies of the environment.  Environments keep their constructor-only
+  // tables behind shared pointers, so a slot only owns the strategies and the
+  // tables derived from them.
   std::vector<Environment> memory_;
   int batch_size_;
   int max_memory_size_;
   int cur_memory_size_ = 0;
   int mem_index_ = 0;
+  bool mix_environments_ = false;
+  ProfileLog profile_;
+  int round_count_ = 0;
+  std::optional<ConvergenceCriteria> criteria_;
+  int stable_rounds_ = 0;
+  std::string checkpoint_path_;
+  int checkpoint_frequency_ = 0;
 };
 
 }  // namespace multipop
@@ -0,0 +1,57 @@
+#ifndef GENERICGA_MULTIPOP_SNAPSHOT_BUFFER_H_
+#define GENERICGA_MULTIPOP_SNAPSHOT_BUFFER_H_
+
+#include <memory>
+#include <mutex>
+#include <utility>
+
+namespace genericga {
+namespace multipop {
+
+// Holds the latest published version of a value as an immutable snapshot.
+// Readers take a reference-counted snapshot that stays valid however many
+// versions are published after it.  Writers are serialized: each update copies
+// the latest value, modifies the copy and publishes it as the next version.
+//
+// This is not lock-free.  libstdc++ implements the shared_ptr atomic_load and
+// atomic_store with a small pool of spinlocks, so a reader can wait on the
+// pointer swap of a concurrent publish.  It never waits on the copy and update
+// work itself, which happens before the swap.
+template <class T>
+class SnapshotBuffer {
+ public:
+  struct Snapshot {
+    T value;
+    long version;
+  };
+
+  explicit SnapshotBuffer(T init)
+      : current_(std::make_shared<const Snapshot>(Snapshot{std::move(init), 0})) {
+  }
+
+  std::shared_ptr<const Snapshot> Load() const {
+    return std::atomic_load(&current_);
+  }
+
+  // Publishes update(copy of latest value) and returns its version.
+  template <class Func>
+  long Update(Func update) {
+    std::lock_guard<std::mutex> lock(write_mutex_);
+    auto latest = std::atomic_load(&current_);
+    Snapshot next{latest->value, latest->version + 1};
+    update(next.value);
+    std::atomic_store(&current_,
+                      std::shared_ptr<const Snapshot>(
+                          std::make_shared<const Snapshot>(std::move(next))));
+    return latest->version + 1;
+  }
+
+ private:
+  std::shared_ptr<const Snapshot> current_;
+  std::mutex write_mutex_;
+};
+
+}  // namespace multipop
+}  // namespace genericga
+
+#endif  // GENERICGA_MULTIPOP_SNAPSHOT_BUFFER_H_
@@ -4,15 +4,21 @@
 #include <algorithm>
 #include <functional>
 #include <iostream>
+#include <istream>
 #include <memory>
+#include <optional>
+#include <ostream>
+#include <string>
 #include <utility>
 #include <vector>
 
 #include "genericga/abstract_single_population_ga.h"
 #include "genericga/multipop/abstract_sub_ga.h"
+#include "genericga/multipop/convergence.h"
 #include "genericga/selector.h"
 #include "genericga/selector/keep_best.h"
 #include "genericga/selector/tournament.h"
+#include "genericga/trace.h"
 
 namespace genericga {
 namespace multipop {
@@ -47,8 +53,22 @@ class SubGAAdapter : public AbstractSubGA<Environment> {
                int priority = 0,
                std::unique_ptr<Selector> selector =
                    std::make_unique<selector::Tournament>(3));
-  void RunRound(const std::vector<Environment*>& envs) override;
+  void RunRound(const std::vector<Environment*>& envs) override {
+    RunRoundOn(envs);
+  }
+  void RunRound(const std::vector<const Environment*>& envs) override {
+    RunRoundOn(envs);
+  }
   void SubmitPlayStrat(Environment& env) override;
+  void SaveCheckpoint(std::ostream& os) const override {
+    selector_->SaveCheckpoint(os);
+    ga_->SaveCheckpoint(os);
+  }
+  void LoadCheckpoint(std::istream& is) override {
+    selector_->LoadCheckpoint(is);
+    ga_->LoadCheckpoint(is);
+  }
+  StrategyChange GetLastChange() const override { return last_change_; }
   PhenotypeStrategy<Phen> SelectStrategy(Selector& sel) {
     return ga_->SelectStrategy(sel);
   }
@@ -67,6 +87,9 @@ class SubGAAdapter : public AbstractSubGA<Environment> {
   }
 
  private:
+  template <typename EnvMap>
+  void RunRoundOn(const std::vector<EnvMap*>& envs);
+
   template <typename EnvMap>
   void SetFitnessCalculator(const std::vector<EnvMap*>& envs, std::true_type) {
     int id = this->GetID();
@@ -109,8 +132,35 @@ class SubGAAdapter : public AbstractSubGA<Environment> {
                                                      int)>::value>());
   }
 
+  // The average fitness of each phenotype over envs, as the fitness
+  // calculator would score them.
+  template <typename EnvMap>
+  std::vector<float> GetFitnesses(const std::vector<Phen>& phens,
+                                  const std::vector<EnvMap*>& envs) const {
+    int id = this->GetID();
+    std::vector<float> tots(phens.size(), 0.0);
+    for (auto env : envs) {
+      if constexpr (HasGetFitness<EnvMap,
+                                  std::vector<float>(const std::vector<Phen>&,
+                                                     int)>::value) {
+        auto env_fits = env->GetFitness(phens, id);
+        std::transform(tots.begin(), tots.end(), env_fits.begin(), tots.begin(),
+                       std::plus<float>());
+      } else {
+        for (int i = 0; i < static_cast<int>(phens.size()); ++i) {
+          tots[i] += env->GetFitness(phens[i], id);
+        }
+      }
+    }
+    for (auto& tot : tots) {
+      tot /= envs.size();
+    }
+    return tots;
+  }
+
   std::unique_ptr<Selector> selector_;
   std::unique_ptr<AbstractSinglePopulationGA<Phen>> ga_;
+  StrategyChange last_change_;
 };
 
 template <class Environment, class Phen>
@@ -122,14 +172,31 @@ SubGAAdapter<Environment, Phen>::SubGAAdapter(
       ga_(std::move(ga)) {}
 
 template <class Environment, class Phen>
-void SubGAAdapter<Environment, Phen>::RunRound(
-    const std::vector<Environment*>& envs) {
+template <typename EnvMap>
+void SubGAAdapter<Environment, Phen>::RunRoundOn(
+    const std::vector<EnvMap*>& envs) {
   SetFitnessCalculator(envs);
+  std::optional<Phen> before;
+  if (this->GetTrackChanges()) {
+    before = ga_->GetBestStrategy().phenotype;
+  }
   ga_->RunRound(1);
+  if (before) {
+    std::vector<Phen> bests{std::move(*before),
+                            ga_->GetBestStrategy().phenotype};
+    MeasureStrategyChange(bests[0], bests[1], &last_change_);
+    std::vector<float> fits = GetFitnesses(bests, envs);
+    last_change_.fitness_change = fits[1] - fits[0];
+  }
+  if (TraceEnabled()) {
+    TraceCounter("best_fitness_" + std::to_string(this->GetID()),
+                 ga_->GetBestStrategy().fitness);
+  }
 }
 
 template <class Environment, class Phen>
 void SubGAAdapter<Environment, Phen>::SubmitPlayStrat(Environment& env) {
+  TraceSpan span("AcceptStrategy");
   env.AcceptStrategy(ga_->SelectStrategy(*selector_).phenotype, this->GetID());
 }
 
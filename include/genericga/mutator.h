@@ -1,12 +1,31 @@
 #ifndef GENERICGA_MUTATOR_H_
 #define GENERICGA_MUTATOR_H_
 
+#include <vector>
+
+#include "genericga/random.h"
+
 namespace genericga {
 
+// Randomly perturbs a genotype.  All randomness comes from gen, so a mutator
+// holds no mutable state and can be applied to many genotypes concurrently.
 template <class Gen>
 class Mutator {
  public:
-  virtual void operator()(Gen& genotype) = 0;
+  virtual void operator()(Gen& genotype, Philox4x32& gen) const = 0;
+
+  // Mutates a whole batch of children.  By default genotype i is mutated on
+  // its own (generation, i) substream of stream, in parallel.  Mutators with a
+  // cheaper population-level scheme can override this.
+  virtual void MutateAll(std::vector<Gen>& genotypes, const Philox4x32& stream,
+                         int generation) const {
+    int n_genotypes = genotypes.size();
+#pragma omp parallel for
+    for (int i = 0; i < n_genotypes; ++i) {
+      auto rng = stream.Substream(generation, i);
+      (*this)(genotypes[i], rng);
+    }
+  }
   virtual ~Mutator() {}
 };
 }  // namespace genericga
@@ -0,0 +1,31 @@
+#ifndef GENERICGA_PARALLEL_H_
+#define GENERICGA_PARALLEL_H_
+
+#include <omp.h>
+
+namespace genericga {
+
+// Runs body(i) for each i in [0, n) as OpenMP tasks.  Called from inside a
+// parallel region, the tasks join the enclosing team, so nested loops (sub-GAs
+// in a tier, then each sub-GA's composite components) share one pool of
+// threads rather than serializing the inner loop or oversubscribing cores.
+template <class Func>
+void ParallelFor(int n, Func body) {
+  if (omp_in_parallel()) {
+#pragma omp taskloop grainsize(1)
+    for (int i = 0; i < n; ++i) {
+      body(i);
+    }
+  } else {
+#pragma omp parallel
+#pragma omp single
+#pragma omp taskloop grainsize(1)
+    for (int i = 0; i < n; ++i) {
+      body(i);
+    }
+  }
+}
+
+}  // namespace genericga
+
+#endif  // GENERICGA_PARALLEL_H_
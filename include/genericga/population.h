@@ -2,15 +2,21 @@
 #define GENERICGA_POPULATION_H_
 
 #include <algorithm>
+#include <cassert>
 #include <functional>
 #include <iostream>
+#include <istream>
 #include <memory>
 #include <numeric>
+#include <ostream>
 #include <utility>
 #include <vector>
 
+#include "genericga/checkpoint.h"
 #include "genericga/genotype_population.h"
 #include "genericga/phenotype_strategy.h"
+#include "genericga/profile.h"
+#include "genericga/vector_ops.h"
 
 namespace genericga {
 
@@ -24,12 +30,26 @@ class Population : public GenotypePopulation<Gen> {
 
   void SetFitnessCalculator(
       std::function<std::vector<float>(const std::vector<Phen>&)> fit_calc);
+  // Records phenotype conversion, fitness, survival and RemoveDead times into
+  // log.
+  void SetProfileLog(std::shared_ptr<ProfileLog> log) {
+    profile_log_ = std::move(log);
+  }
+
+  // Genotypes, fitnesses, counts and ordering.  Phenotypes are converted
+  // again on load.
+  void SaveCheckpoint(std::ostream& os) const;
+  void LoadCheckpoint(std::istream& is);
 
   void AddGenotypes(std::vector<Gen> genes) override;
+  // Fitnesses genes would have if added, leaving the population unchanged.
+  std::vector<float> ScoreGenotypes(const std::vector<Gen>& genes) const;
   void Survival(Selector& selector, int n) override;
 
   Gen SelectGenotype(Selector& selector) const override;
   std::vector<Gen> SelectGenotypes(Selector& selector, int n) const override;
+  std::vector<int> SelectParentIndices(Selector& selector,
+                                       int n) const override;
   PhenotypeStrategy<Phen> SelectPhenotypeStrategy(Selector& selector) const;
   std::vector<PhenotypeStrategy<Phen>> SelectPhenotypeStrategies(
       Selector& selector, int n) const;
@@ -38,9 +58,11 @@ class Population : public GenotypePopulation<Gen> {
   }
 
   std::vector<Gen> GetGenotypes() const override { return genes_; }
+  const Gen& GetGenotype(int index) const override { return genes_[index]; }
   std::vector<Phen> GetPhenotypes() const { return phens_; }
   std::vector<float> GetFitnesses() const override { return fits_; }
   std::vector<int> GetCounts() const { return counts_; }
+  const std::vector<int>& GetOrdering() const { return ordering_; }
   std::vector<PhenotypeStrategy<Phen>> GetPhenotypeStrategies() const;
 
  private:
@@ -50,8 +72,12 @@ class Population : public GenotypePopulation<Gen> {
   std::vector<Phen> phens_;
   std::vector<float> fits_;
   std::vector<int> counts_;
+  // Indices sorted by ascending fitness.  Rebuilt when the fitness calculator
+  // changes, extended as children are added, and shared by every selection.
+  std::vector<int> ordering_;
   std::function<Phen(const Gen&)> phen_conv_;
   std::function<std::vector<float>(const std::vector<Phen>&)> fit_calc_;
+  std::shared_ptr<ProfileLog> profile_log_;
 };
 
 template <class Gen, class Phen>
@@ -72,16 +98,64 @@ template <class Gen, class Phen>
 void Population<Gen, Phen>::SetFitnessCalculator(
     std::function<std::vector<float>(const std::vector<Phen>&)> fit_calc) {
   fit_calc_ = std::move(fit_calc);
-  fits_ = fit_calc_(phens_);
+  {
+    PhaseTimer timer(profile_log_.get(), "fitness");
+    fits_ = fit_calc_(phens_);
+  }
+  ProfileCount(profile_log_.get(), "fitness_evals", phens_.size());
+  ordering_ = GetOrderings(fits_);
+}
+
+template <class Gen, class Phen>
+void Population<Gen, Phen>::SaveCheckpoint(std::ostream& os) const {
+  WriteBinary(os, genes_);
+  WriteBinary(os, fits_);
+  WriteBinary(os, counts_);
+  WriteBinary(os, ordering_);
+}
+
+template <class Gen, class Phen>
+void Population<Gen, Phen>::LoadCheckpoint(std::istream& is) {
+  ReadBinary(is, &genes_);
+  ReadBinary(is, &fits_);
+  ReadBinary(is, &counts_);
+  ReadBinary(is, &ordering_);
+  int size = genes_.size();
+  if (static_cast<int>(fits_.size()) != size ||
+      static_cast<int>(counts_.size()) != size ||
+      static_cast<int>(ordering_.size()) != size) {
+    throw CheckpointError("checkpoint population sizes disagree");
+  }
+  // The ordering indexes genes_ unchecked, so it must be a permutation.
+  std::vector<bool> seen(size, false);
+  for (int i : ordering_) {
+    if (i < 0 || i >= size || seen[i]) {
+      throw CheckpointError("checkpoint population ordering is corrupt");
+    }
+    seen[i] = true;
+  }
+  phens_.clear();
+  phens_.reserve(genes_.size());
+  std::transform(genes_.begin(), genes_.end(), std::back_inserter(phens_),
+                 phen_conv_);
 }
 
 template <class Gen, class Phen>
 void Population<Gen, Phen>::AddGenotypes(std::vector<Gen> new_genes) {
+  ProfileLog* log = profile_log_.get();
   std::vector<Phen> new_phens;
   new_phens.reserve(new_genes.size());
-  std::transform(new_genes.begin(), new_genes.end(),
-                 std::back_inserter(new_phens), phen_conv_);
-  auto new_fits = fit_calc_(new_phens);
+  {
+    PhaseTimer timer(log, "phenotype_conversion");
+    std::transform(new_genes.begin(), new_genes.end(),
+                   std::back_inserter(new_phens), phen_conv_);
+  }
+  std::vector<float> new_fits;
+  {
+    PhaseTimer timer(log, "fitness");
+    new_fits = fit_calc_(new_phens);
+  }
+  ProfileCount(log, "fitness_evals", new_phens.size());
 
   std::copy(std::make_move_iterator(new_genes.begin()),
             std::make_move_iterator(new_genes.end()),
@@ -92,23 +166,49 @@ void Population<Gen, Phen>::AddGenotypes(std::vector<Gen> new_genes) {
   std::copy(new_fits.begin(), new_fits.end(), std::back_inserter(fits_));
 
   std::fill_n(std::back_inserter(counts_), new_genes.size(), 1);
+  MergeOrderings(fits_, ordering_);
+}
+
+template <class Gen, class Phen>
+std::vector<float> Population<Gen, Phen>::ScoreGenotypes(
+    const std::vector<Gen>& genes) const {
+  std::vector<Phen> phens;
+  phens.reserve(genes.size());
+  std::transform(genes.begin(), genes.end(), std::back_inserter(phens),
+                 phen_conv_);
+  return fit_calc_(phens);
 }
 
 template <class Gen, class Phen>
 void Population<Gen, Phen>::Survival(Selector& selector, int n) {
-  auto inds = selector.SelectIndices(fits_, counts_, n);
-  std::fill(counts_.begin(), counts_.end(), 0);
-  for (int ind : inds) {
-    ++counts_[ind];
+  ProfileLog* log = profile_log_.get();
+  {
+    PhaseTimer timer(log, "survival");
+    auto inds = selector.SelectIndices(fits_, counts_, ordering_, n);
+    std::fill(counts_.begin(), counts_.end(), 0);
+    for (int ind : inds) {
+      ++counts_[ind];
+    }
+  }
+  int size = counts_.size();
+  {
+    PhaseTimer timer(log, "remove_dead");
+    RemoveDead();
   }
-  RemoveDead();
+  ProfileCount(log, "dead_removed", size - counts_.size());
 }
 
 // 0-count strategies are "Dead".  Move non-dead from the end to take their
-// place, and then truncate the vectors
+// place, and then truncate the vectors.  The ordering is remapped to the new
+// indices rather than re-sorted, since no fitness changes.
 template <class Gen, class Phen>
 void Population<Gen, Phen>::RemoveDead() {
   int size = counts_.size();
+  // Where each index ends up, or -1 if it is removed.
+  std::vector<int> new_inds(size);
+  for (int i = 0; i < size; ++i) {
+    new_inds[i] = counts_[i] == 0 ? -1 : i;
+  }
   for (int i = 0; i < size; ++i) {
     // Find an open spot due to a dead strategy
     if (counts_[i] == 0) {
@@ -122,6 +222,10 @@ void Population<Gen, Phen>::RemoveDead() {
         phens_[i] = std::move(phens_[size - 1]);
         fits_[i] = fits_[size - 1];
         counts_[i] = counts_[size - 1];
+        new_inds[size - 1] = i;
+        --size;
+      } else {
+        // The dead strategy is already last, so just drop it.
         --size;
       }
     }
@@ -131,6 +235,13 @@ void Population<Gen, Phen>::RemoveDead() {
   phens_.erase(phens_.begin() + size, phens_.end());
   fits_.resize(size);
   counts_.resize(size);
+
+  auto last = std::remove_if(ordering_.begin(), ordering_.end(),
+                             [&new_inds](int ind) { return new_inds[ind] < 0; });
+  ordering_.erase(last, ordering_.end());
+  for (auto& ind : ordering_) {
+    ind = new_inds[ind];
+  }
 }
 
 template <class Gen, class Phen>
@@ -141,13 +252,21 @@ Gen Population<Gen, Phen>::SelectGenotype(Selector& selector) const {
 template <class Gen, class Phen>
 std::vector<Gen> Population<Gen, Phen>::SelectGenotypes(Selector& selector,
                                                         int n) const {
-  auto inds = selector.SelectIndices(fits_, counts_, n);
+  auto inds = SelectParentIndices(selector, n);
   std::vector<Gen> out_genes;
   out_genes.reserve(n);
   for (int i : inds) {
     out_genes.push_back(genes_[i]);
   }
-  return genes_;
+  return out_genes;
+}
+
+// Selects parents by index only, so callers can build children directly from
+// GetGenotype without an intermediate copy of every parent.
+template <class Gen, class Phen>
+std::vector<int> Population<Gen, Phen>::SelectParentIndices(Selector& selector,
+                                                            int n) const {
+  return selector.SelectIndices(fits_, counts_, ordering_, n);
 }
 
 template <class Gen, class Phen>
@@ -160,7 +279,7 @@ template <class Gen, class Phen>
 std::vector<PhenotypeStrategy<Phen>>
 Population<Gen, Phen>::SelectPhenotypeStrategies(Selector& selector,
                                                  int n) const {
-  auto inds = selector.SelectIndices(fits_, counts_, n);
+  auto inds = selector.SelectIndices(fits_, counts_, ordering_, n);
   std::vector<PhenotypeStrategy<Phen>> strats;
   strats.reserve(n);
   for (int ind : inds) {
@@ -0,0 +1,96 @@
+#ifndef GENERICGA_PROFILE_H_
+#define GENERICGA_PROFILE_H_
+
+#include <chrono>
+#include <map>
+#include <ostream>
+#include <string>
+#include <vector>
+
+namespace genericga {
+
+// Phase timing is compiled in only when GENERICGA_PROFILE is defined (cmake
+// -DGENERICGA_PROFILE=ON).  Otherwise PhaseTimer and ProfileCount do nothing
+// and the GAs never allocate a ProfileLog.
+#ifdef GENERICGA_PROFILE
+inline constexpr bool kProfileEnabled = true;
+#else
+inline constexpr bool kProfileEnabled = false;
+#endif
+
+// Wall times and counters by name, one row per generation.  Not thread safe:
+// each GA owns its own log and records into it from one thread.
+class ProfileLog {
+ public:
+  ProfileLog() : generations_(1) {}
+
+  // Adds to the named timer or counter of the current generation.
+  void AddTime(const std::string& name, double seconds) {
+    generations_.back().times[name] += seconds;
+  }
+  void AddCount(const std::string& name, long count) {
+    generations_.back().counts[name] += count;
+  }
+  // Closes the current generation and starts recording the next.
+  void NextGeneration() { generations_.emplace_back(); }
+
+  // Closed generations, not counting the one being recorded.
+  int GetGenerationCount() const { return generations_.size() - 1; }
+  double GetTime(int generation, const std::string& name) const;
+  long GetCount(int generation, const std::string& name) const;
+
+  // A header row, then one row per closed generation with its number and a
+  // column per timer (seconds) and counter.
+  void WriteCSV(std::ostream& os) const;
+  // An array of {"generation", "times", "counts"} objects, one per closed
+  // generation.
+  void WriteJSON(std::ostream& os) const;
+
+ private:
+  struct Generation {
+    std::map<std::string, double> times;
+    std::map<std::string, long> counts;
+  };
+
+  std::vector<Generation> generations_;
+};
+
+// Adds its lifetime to a timer in log, if log is not null.
+class PhaseTimer {
+ public:
+  PhaseTimer(ProfileLog* log, const char* name) {
+    if constexpr (kProfileEnabled) {
+      log_ = log;
+      name_ = name;
+      start_ = std::chrono::steady_clock::now();
+    }
+  }
+  ~PhaseTimer() {
+    if constexpr (kProfileEnabled) {
+      if (log_ != nullptr) {
+        std::chrono::duration<double> elapsed =
+            std::chrono::steady_clock::now() - start_;
+        log_->AddTime(name_, elapsed.count());
+      }
+    }
+  }
+  PhaseTimer(const PhaseTimer&) = delete;
+  PhaseTimer& operator=(const PhaseTimer&) = delete;
+
+ private:
+  ProfileLog* log_ = nullptr;
+  const char* name_ = nullptr;
+  std::chrono::steady_clock::time_point start_;
+};
+
+inline void ProfileCount(ProfileLog* log, const char* name, long count) {
+  if constexpr (kProfileEnabled) {
+    if (log != nullptr) {
+      log->AddCount(name, count);
+    }
+  }
+}
+
+}  // namespace genericga
+
+#endif  // GENERICGA_PROFILE_H_
@@ -0,0 +1,64 @@
+#ifndef GENERICGA_RANDOM_H_
+#define GENERICGA_RANDOM_H_
+
+#include <array>
+#include <cstdint>
+
+namespace genericga {
+
+// Philox4x32-10 counter-based generator (Salmon et al., "Parallel Random
+// Numbers: As Easy as 1, 2, 3").  Output is a pure function of a 64-bit key
+// and a 128-bit counter, so a stream can be recreated anywhere from its ids
+// alone and streams never overlap.  The counter is laid out as
+// (block, individual, generation, stream): the key is the run seed, stream
+// identifies the operator that owns the generator, and Substream picks out
+// one (generation, individual) pair within it.
+//
+// Satisfies UniformRandomBitGenerator, producing 32-bit words.
+class Philox4x32 {
+ public:
+  using result_type = std::uint32_t;
+
+  explicit Philox4x32(std::uint64_t key = 0, std::uint32_t stream = 0,
+                      std::uint32_t generation = 0,
+                      std::uint32_t individual = 0);
+
+  result_type operator()() {
+    if (out_index_ == 4) {
+      Generate();
+    }
+    return out_[out_index_++];
+  }
+  void discard(unsigned long long n);
+
+  // Fresh generator on the same key and stream, for one individual in one
+  // generation.
+  Philox4x32 Substream(std::uint32_t generation,
+                       std::uint32_t individual) const;
+
+  static constexpr result_type min() { return 0; }
+  static constexpr result_type max() { return 0xFFFFFFFFu; }
+
+ private:
+  void Generate();
+
+  std::array<std::uint32_t, 2> key_;
+  std::array<std::uint32_t, 4> counter_;
+  std::array<std::uint32_t, 4> out_;
+  int out_index_ = 4;
+};
+
+// The run seed is the key for every stream handed out by MakeStream.  Unless
+// SetRunSeed is called it comes from std::random_device on first use.
+// SetRunSeed also restarts stream numbering, so calling it before building
+// the GAs makes the whole run reproducible.
+void SetRunSeed(std::uint64_t seed);
+std::uint64_t GetRunSeed();
+
+// Returns a generator on the run seed with the next unused stream id.  Ids
+// are assigned in construction order.
+Philox4x32 MakeStream();
+
+}  // namespace genericga
+
+#endif  // GENERICGA_RANDOM_H_
@@ -5,6 +5,7 @@
 #include <vector>
 
 #include "genericga/mutator.h"
+#include "genericga/random.h"
 
 namespace genericga {
 namespace real {
@@ -12,40 +13,29 @@ namespace real {
 class ModifyMutation : public Mutator<std::vector<double>> {
  public:
   ModifyMutation(double prob_rate, double std_dev, double min, double max)
-      : gen_(std::random_device()()),
-        muts_dist_(prob_rate),
-        ind_dist_(0, 0),
-        val_dist_(0, std_dev),
-        min_(min),
-        max_(max),
-        gene_size_(0) {}
+      : prob_rate_(prob_rate), std_dev_(std_dev), min_(min), max_(max) {}
 
-  void operator()(std::vector<double>& gene) override {
-    if (gene.size() != gene_size_) {
-      gene_size_ = gene.size();
-      ind_dist_ = std::uniform_int_distribution<>(0, gene_size_ - 1);
-    }
-
-    int n_muts = muts_dist_(gen_);
+  void operator()(std::vector<double>& gene, Philox4x32& gen) const override {
+    std::poisson_distribution<> muts_dist(prob_rate_);
+    std::uniform_int_distribution<> ind_dist(0, gene.size() - 1);
+    int n_muts = muts_dist(gen);
     for (int i = 0; i < n_muts; ++i) {
-      int ind = ind_dist_(gen_);
-      gene[ind] = Mutate(gene[ind]);
+      int ind = ind_dist(gen);
+      gene[ind] = Mutate(gene[ind], gen);
     }
   }
 
  private:
-  double Mutate(double val) {
-    double new_val = val + val_dist_(gen_);
-    if (new_val < min_ || new_val > max_) {
-      return Mutate(val);
+  double Mutate(double val, Philox4x32& gen) const {
+    std::normal_distribution<> val_dist(0, std_dev_);
+    double new_val = val + val_dist(gen);
+    while (new_val < min_ || new_val > max_) {
+      new_val = val + val_dist(gen);
     }
     return new_val;
   }
-  std::mt19937 gen_;
-  std::poisson_distribution<> muts_dist_;
-  std::uniform_int_distribution<> ind_dist_;
-  std::normal_distribution<> val_dist_;
-  int gene_size_;
+  double prob_rate_;
+  double std_dev_;
   double min_;
   double max_;
 };
@@ -1,6 +1,8 @@
 #ifndef GENERICGA_SELECTOR_H_
 #define GENERICGA_SELECTOR_H_
 
+#include <istream>
+#include <ostream>
 #include <vector>
 
 namespace genericga {
@@ -10,6 +12,17 @@ class Selector {
   virtual std::vector<int> SelectIndices(const std::vector<float>& fitnesses,
                                          const std::vector<int>& counts,
                                          int n) = 0;
+  // Same as above, with an ordering of fitnesses (as from GetOrderings)
+  // already computed, so rank-based selectors can skip sorting.
+  virtual std::vector<int> SelectIndices(
+      const std::vector<float>& fitnesses, const std::vector<int>& counts,
+      const std::vector<int>& /*ordering*/, int n) {
+    return SelectIndices(fitnesses, counts, n);
+  }
+  // Selectors that draw random numbers save their generator, so a resumed run
+  // makes the same selections.
+  virtual void SaveCheckpoint(std::ostream& os) const {}
+  virtual void LoadCheckpoint(std::istream& is) {}
   virtual ~Selector() {}
 };
 
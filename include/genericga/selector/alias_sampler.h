@@ -0,0 +1,79 @@
+#ifndef GENERICGA_SELECTOR_ALIAS_SAMPLER_H_
+#define GENERICGA_SELECTOR_ALIAS_SAMPLER_H_
+
+#include <cstdint>
+#include <vector>
+
+namespace genericga {
+namespace selector {
+
+// Walker/Vose alias table for drawing indices with probability proportional to
+// a set of non-negative weights.  Building the table is O(n) and each draw is
+// O(1), using one 32-bit random number to pick a column and another to choose
+// between the column and its alias.  Buffers are reused across Reset calls, so
+// rebuilding for a same-sized population does not allocate.  If every weight
+// is zero, all indices are equally likely.
+class AliasSampler {
+ public:
+  AliasSampler() {}
+  template <class T>
+  explicit AliasSampler(const std::vector<T>& weights) {
+    Reset(weights);
+  }
+
+  template <class T>
+  void Reset(const std::vector<T>& weights) {
+    scaled_.assign(weights.begin(), weights.end());
+    Build();
+  }
+
+  template <class URNG>
+  int operator()(URNG& gen) const {
+    return Draw(Next32(gen), Next32(gen));
+  }
+
+  // Fills out[0..n) with independent draws.  The random words are generated
+  // first so the table lookups run as a separate branch-free loop.
+  template <class URNG>
+  void Sample(URNG& gen, int* out, int n) {
+    words_.resize(2 * n);
+    for (auto& word : words_) {
+      word = Next32(gen);
+    }
+    for (int i = 0; i < n; ++i) {
+      out[i] = Draw(words_[2 * i], words_[2 * i + 1]);
+    }
+  }
+
+  int Size() const { return probs_.size(); }
+
+ private:
+  template <class URNG>
+  static std::uint32_t Next32(URNG& gen) {
+    static_assert(URNG::max() - URNG::min() == 0xFFFFFFFFu,
+                  "AliasSampler requires a 32-bit generator.");
+    return static_cast<std::uint32_t>(gen() - URNG::min());
+  }
+
+  int Draw(std::uint32_t col_word, std::uint32_t coin_word) const {
+    int col = static_cast<int>(
+        (static_cast<std::uint64_t>(col_word) * probs_.size()) >> 32);
+    return coin_word < probs_[col] ? col : aliases_[col];
+  }
+
+  void Build();
+
+  // Probabilities are stored as 32-bit thresholds so the coin flip is an
+  // integer comparison.
+  std::vector<std::uint64_t> probs_;
+  std::vector<int> aliases_;
+  std::vector<double> scaled_;
+  std::vector<int> small_;
+  std::vector<int> large_;
+  std::vector<std::uint32_t> words_;
+};
+
+}  // namespace selector
+}  // namespace genericga
+
+#endif  // GENERICGA_SELECTOR_ALIAS_SAMPLER_H_
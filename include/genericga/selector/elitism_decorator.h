@@ -1,7 +1,9 @@
 #ifndef GENERICGA_SELECTOR_ELITISM_DECORATOR_H_
 #define GENERICGA_SELECTOR_ELITISM_DECORATOR_H_
 
+#include <istream>
 #include <memory>
+#include <ostream>
 #include <vector>
 
 #include "genericga/selector.h"
@@ -16,6 +18,14 @@ class ElitismDecorator : public Selector {
   std::vector<int> SelectIndices(const std::vector<float>& fitnesses,
                                  const std::vector<int>& counts,
                                  int n) override;
+  std::vector<int> SelectIndices(const std::vector<float>& fitnesses,
+                                 const std::vector<int>& counts,
+                                 const std::vector<int>& ordering,
+                                 int n) override;
+  void SaveCheckpoint(std::ostream& os) const override {
+    sel_->SaveCheckpoint(os);
+  }
+  void LoadCheckpoint(std::istream& is) override { sel_->LoadCheckpoint(is); }
 
  private:
   std::unique_ptr<Selector> sel_;
@@ -14,6 +14,10 @@ class KeepBest : public Selector {
   std::vector<int> SelectIndices(const std::vector<float>& fitnesses,
                                  const std::vector<int>& counts,
                                  int n) override;
+  std::vector<int> SelectIndices(const std::vector<float>& fitnesses,
+                                 const std::vector<int>& counts,
+                                 const std::vector<int>& ordering,
+                                 int n) override;
 };
 
 }  // namespace selector
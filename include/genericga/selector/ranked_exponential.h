@@ -14,6 +14,9 @@ class RankedExponential : public Roulette {
   explicit RankedExponential(int seed) : Roulette(seed) {}
   std::vector<float> CalculateWeights(
       const std::vector<float>& fitnesses) const override;
+  std::vector<float> CalculateWeights(
+      const std::vector<float>& fitnesses,
+      const std::vector<int>& ordering) const override;
 };
 
 }  // namespace selector
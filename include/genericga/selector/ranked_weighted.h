@@ -23,6 +23,9 @@ class RankedWeighted : public Roulette {
   }
   std::vector<float> CalculateWeights(
       const std::vector<float>& fitnesses) const override;
+  std::vector<float> CalculateWeights(
+      const std::vector<float>& fitnesses,
+      const std::vector<int>& ordering) const override;
 
  private:
   float weight_;
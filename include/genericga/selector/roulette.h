@@ -1,10 +1,14 @@
 #ifndef GENERICGA_SELECTOR_ROULETTE_H_
 #define GENERICGA_SELECTOR_ROULETTE_H_
 
+#include <istream>
+#include <ostream>
 #include <random>
 #include <vector>
 
+#include "genericga/random.h"
 #include "genericga/selector.h"
+#include "genericga/selector/alias_sampler.h"
 
 namespace genericga {
 namespace selector {
@@ -16,11 +20,28 @@ class Roulette : public Selector {
   std::vector<int> SelectIndices(const std::vector<float>& fitnesses,
                                  const std::vector<int>& counts,
                                  int n) override;
+  std::vector<int> SelectIndices(const std::vector<float>& fitnesses,
+                                 const std::vector<int>& counts,
+                                 const std::vector<int>& ordering,
+                                 int n) override;
   virtual std::vector<float> CalculateWeights(
       const std::vector<float>& fitnesses) const = 0;
+  // Rank-based weightings override this to reuse a precomputed ordering.
+  virtual std::vector<float> CalculateWeights(
+      const std::vector<float>& fitnesses,
+      const std::vector<int>& /*ordering*/) const {
+    return CalculateWeights(fitnesses);
+  }
+
+  void SaveCheckpoint(std::ostream& os) const override;
+  void LoadCheckpoint(std::istream& is) override;
 
  private:
-  std::mt19937 gen_;
+  std::vector<int> SelectFromWeights(std::vector<float> weights,
+                                     const std::vector<int>& counts, int n);
+
+  Philox4x32 gen_;
+  AliasSampler sampler_;
 };
 
 }  // namespace selector
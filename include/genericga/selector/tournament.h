@@ -1,10 +1,14 @@
 #ifndef GENERICGA_SELECTOR_TOURNAMENT_H_
 #define GENERICGA_SELECTOR_TOURNAMENT_H_
 
+#include <istream>
+#include <ostream>
 #include <random>
 #include <vector>
 
+#include "genericga/random.h"
 #include "genericga/selector.h"
+#include "genericga/selector/alias_sampler.h"
 
 namespace genericga {
 namespace selector {
@@ -17,15 +21,26 @@ class Tournament : public Selector {
   std::vector<int> SelectIndices(const std::vector<float>& fitnesses,
                                  const std::vector<int>& counts,
                                  int n) override;
-  int TournamentRound(const std::vector<int>& ranks, std::vector<int> entrants);
-  std::vector<int> GenerateTournamentIndices();
+  std::vector<int> SelectIndices(const std::vector<float>& fitnesses,
+                                 const std::vector<int>& counts,
+                                 const std::vector<int>& ordering,
+                                 int n) override;
+
+  void SaveCheckpoint(std::ostream& os) const override;
+  void LoadCheckpoint(std::istream& is) override;
 
  private:
   int tourn_size_;
-  std::mt19937 gen_;
-  std::discrete_distribution<> dist_;
+  Philox4x32 gen_;
+  AliasSampler sampler_;
+  std::vector<int> entrants_;
 };
 
+// Returns the entrant with the highest rank, preferring the earliest entrant
+// on ties.
+int TournamentWinner(const std::vector<int>& ranks, const int* entrants,
+                     int n_entrants);
+
 }  // namespace selector
 }  // namespace genericga
 
@@ -1,10 +1,14 @@
 #ifndef GENERICGA_SELECTOR_TOURNAMENT_MIXED_H_
 #define GENERICGA_SELECTOR_TOURNAMENT_MIXED_H_
 
+#include <istream>
+#include <ostream>
 #include <random>
 #include <vector>
 
+#include "genericga/random.h"
 #include "genericga/selector.h"
+#include "genericga/selector/alias_sampler.h"
 
 namespace genericga {
 namespace selector {
@@ -17,14 +21,22 @@ class TournamentMixed : public Selector {
   std::vector<int> SelectIndices(const std::vector<float>& fitnesses,
                                  const std::vector<int>& counts,
                                  int n) override;
-  int TournamentRound(const std::vector<int>& ranks, std::vector<int> entrants);
-  std::vector<int> GenerateTournamentIndices(int cur, int n_draws);
+  std::vector<int> SelectIndices(const std::vector<float>& fitnesses,
+                                 const std::vector<int>& counts,
+                                 const std::vector<int>& ordering,
+                                 int n) override;
+
+  void SaveCheckpoint(std::ostream& os) const override;
+  void LoadCheckpoint(std::istream& is) override;
 
  private:
+  int TournamentSize(int cur, int n_draws) const;
+
   int base_tourn_size_;
   float frac_extra_;
-  std::mt19937 gen_;
-  std::discrete_distribution<> ind_dist_;
+  Philox4x32 gen_;
+  AliasSampler sampler_;
+  std::vector<int> entrants_;
 };
 
 }  // namespace selector
@@ -1,10 +1,14 @@
 #ifndef GENERICGA_SELECTOR_TOURNAMENT_POISSON_H_
 #define GENERICGA_SELECTOR_TOURNAMENT_POISSON_H_
 
+#include <istream>
+#include <ostream>
 #include <random>
 #include <vector>
 
+#include "genericga/random.h"
 #include "genericga/selector.h"
+#include "genericga/selector/alias_sampler.h"
 
 namespace genericga {
 namespace selector {
@@ -17,13 +21,20 @@ class TournamentPoisson : public Selector {
   std::vector<int> SelectIndices(const std::vector<float>& fitnesses,
                                  const std::vector<int>& counts,
                                  int n) override;
-  int TournamentRound(const std::vector<int>& ranks, std::vector<int> entrants);
-  std::vector<int> GenerateTournamentIndices();
+  std::vector<int> SelectIndices(const std::vector<float>& fitnesses,
+                                 const std::vector<int>& counts,
+                                 const std::vector<int>& ordering,
+                                 int n) override;
+
+  void SaveCheckpoint(std::ostream& os) const override;
+  void LoadCheckpoint(std::istream& is) override;
 
  private:
-  std::mt19937 gen_;
-  std::discrete_distribution<> ind_dist_;
+  Philox4x32 gen_;
+  AliasSampler sampler_;
   std::poisson_distribution<> extra_size_dist_;
+  std::vector<int> sizes_;
+  std::vector<int> entrants_;
 };
 
 }  // namespace selector
@@ -1,14 +1,21 @@
 #ifndef GENERICGA_SINGLE_POPULATION_GA_H_
 #define GENERICGA_SINGLE_POPULATION_GA_H_
 
+#include <cassert>
+#include <istream>
+#include <iterator>
 #include <memory>
+#include <ostream>
 #include <utility>
 #include <vector>
 
 #include "genericga/abstract_single_population_ga.h"
+#include "genericga/checkpoint.h"
 #include "genericga/children_factory.h"
+#include "genericga/local_search.h"
 #include "genericga/phenotype_strategy.h"
 #include "genericga/population.h"
+#include "genericga/profile.h"
 #include "genericga/selector.h"
 #include "genericga/selector/elitism_decorator.h"
 #include "genericga/selector/keep_best.h"
@@ -31,6 +38,20 @@ class SinglePopulationGA : public AbstractSinglePopulationGA<Phen> {
       std::function<std::vector<float>(const std::vector<Phen>&)> fit_calc)
       override;
 
+  // Every frequency rounds, runs search from the best genotype and adds what
+  // it returns alongside that round's children.  The rounds since the last
+  // search are checkpointed, so a resumed run searches on the same rounds.
+  void SetLocalSearch(LocalSearch<Gen> search, int frequency) {
+    assert(frequency > 0);
+    local_search_ = std::move(search);
+    search_frequency_ = frequency;
+    rounds_since_search_ = 0;
+  }
+
+  // Phase times and counters per round; null unless built with
+  // GENERICGA_PROFILE.
+  const ProfileLog* GetProfileLog() const { return profile_log_.get(); }
+
   std::vector<PhenotypeStrategy<Phen>> GetPopulation() const {
     return pop_.GetPhenotypeStrategies();
   }
@@ -60,6 +81,20 @@ class SinglePopulationGA : public AbstractSinglePopulationGA<Phen> {
     return SelectStrategies(commonest_sel, n);
   }
 
+  void SaveCheckpoint(std::ostream& os) const override {
+    pop_.SaveCheckpoint(os);
+    survivor_selector_->SaveCheckpoint(os);
+    children_fact_->SaveCheckpoint(os);
+    WriteBinary(os, rounds_since_search_);
+  }
+
+  void LoadCheckpoint(std::istream& is) override {
+    pop_.LoadCheckpoint(is);
+    survivor_selector_->LoadCheckpoint(is);
+    children_fact_->LoadCheckpoint(is);
+    ReadBinary(is, &rounds_since_search_);
+  }
+
  private:
   void RunSingleRound();
 
@@ -70,6 +105,10 @@ class SinglePopulationGA : public AbstractSinglePopulationGA<Phen> {
   selector::KeepCommonest commonest_sel;
   std::unique_ptr<Selector> survivor_selector_;
   std::unique_ptr<ChildrenFactory<Gen>> children_fact_;
+  std::shared_ptr<ProfileLog> profile_log_;
+  LocalSearch<Gen> local_search_;
+  int search_frequency_ = 1;
+  int rounds_since_search_ = 0;
 };
 
 template <class Gen, class Phen>
@@ -83,13 +122,33 @@ SinglePopulationGA<Gen, Phen>::SinglePopulationGA(
       survivor_selector_(std::move(survivor_selector)),
       children_fact_(std::move(children_fact)),
       best_sel(),
-      commonest_sel() {}
+      commonest_sel() {
+  if constexpr (kProfileEnabled) {
+    profile_log_ = std::make_shared<ProfileLog>();
+    pop_.SetProfileLog(profile_log_);
+    children_fact_->SetProfileLog(profile_log_);
+  }
+}
 
 template <class Gen, class Phen>
 void SinglePopulationGA<Gen, Phen>::RunSingleRound() {
   auto children = children_fact_->GetChildren(pop_, n_children_);
+  if (local_search_ && ++rounds_since_search_ == search_frequency_) {
+    rounds_since_search_ = 0;
+    ProfileLog* log = profile_log_.get();
+    PhaseTimer timer(log, "local_search");
+    GenotypeFitness<Gen> fitness = [this, log](const std::vector<Gen>& genes) {
+      ProfileCount(log, "local_search_evals", genes.size());
+      return pop_.ScoreGenotypes(genes);
+    };
+    auto improved = local_search_(pop_.SelectGenotype(best_sel), fitness);
+    std::move(improved.begin(), improved.end(), std::back_inserter(children));
+  }
   pop_.AddGenotypes(std::move(children));
   pop_.Survival(*survivor_selector_, n_strategies_);
+  if (profile_log_) {
+    profile_log_->NextGeneration();
+  }
 }
 
 template <class Gen, class Phen>
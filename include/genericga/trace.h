@@ -0,0 +1,120 @@
+#ifndef GENERICGA_TRACE_H_
+#define GENERICGA_TRACE_H_
+
+#include <chrono>
+#include <map>
+#include <mutex>
+#include <ostream>
+#include <string>
+#include <thread>
+#include <utility>
+#include <vector>
+
+#include "genericga/profile.h"
+
+namespace genericga {
+
+// Collects spans and counters from any thread and writes them as Chrome
+// trace-event JSON, which chrome://tracing and ui.perfetto.dev open with one
+// track per thread.
+class TraceSink {
+ public:
+  using Clock = std::chrono::steady_clock;
+
+  TraceSink() : start_(Clock::now()) {}
+
+  // A span on the calling thread's track.
+  void AddSpan(const std::string& name, Clock::time_point start,
+               Clock::time_point end);
+  // A sample of the named counter track, taken now.
+  void AddCounter(const std::string& name, double value);
+
+  int GetEventCount() const;
+  // {"traceEvents": [...]} with timestamps in microseconds since the sink was
+  // created.
+  void WriteJSON(std::ostream& os) const;
+
+ private:
+  struct Event {
+    char phase;
+    std::string name;
+    double timestamp;
+    double value;  // Duration for spans.
+    int thread;
+  };
+
+  // Small, stable track numbers in order of each thread's first event.
+  int ThreadIndex();
+  double Micros(Clock::time_point time) const {
+    return std::chrono::duration<double, std::micro>(time - start_).count();
+  }
+
+  Clock::time_point start_;
+  mutable std::mutex mutex_;
+  std::vector<Event> events_;
+  std::map<std::thread::id, int> threads_;
+};
+
+// The sink TraceSpan and TraceCounter record into.  Tracing is off while it is
+// null, the default, and always off unless built with GENERICGA_PROFILE.  The
+// sink must outlive every GA that runs while it is set.
+void SetTraceSink(TraceSink* sink);
+TraceSink* GetTraceSink();
+
+inline bool TraceEnabled() {
+  if constexpr (kProfileEnabled) {
+    return GetTraceSink() != nullptr;
+  }
+  return false;
+}
+
+// Records its lifetime as a span on the calling thread.
+class TraceSpan {
+ public:
+  explicit TraceSpan(std::string name) {
+    if constexpr (kProfileEnabled) {
+      sink_ = GetTraceSink();
+      if (sink_ != nullptr) {
+        name_ = std::move(name);
+        start_ = TraceSink::Clock::now();
+      }
+    }
+  }
+  // Named prefix, index, suffix, so per-component spans build no string
+  // unless tracing is on.
+  TraceSpan(const char* prefix, int index, const char* suffix = "") {
+    if constexpr (kProfileEnabled) {
+      sink_ = GetTraceSink();
+      if (sink_ != nullptr) {
+        name_ = prefix + std::to_string(index) + suffix;
+        start_ = TraceSink::Clock::now();
+      }
+    }
+  }
+  ~TraceSpan() {
+    if constexpr (kProfileEnabled) {
+      if (sink_ != nullptr) {
+        sink_->AddSpan(name_, start_, TraceSink::Clock::now());
+      }
+    }
+  }
+  TraceSpan(const TraceSpan&) = delete;
+  TraceSpan& operator=(const TraceSpan&) = delete;
+
+ private:
+  TraceSink* sink_ = nullptr;
+  std::string name_;
+  TraceSink::Clock::time_point start_;
+};
+
+inline void TraceCounter(const std::string& name, double value) {
+  if constexpr (kProfileEnabled) {
+    if (auto sink = GetTraceSink()) {
+      sink->AddCounter(name, value);
+    }
+  }
+}
+
+}  // namespace genericga
+
+#endif  // GENERICGA_TRACE_H_
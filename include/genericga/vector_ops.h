@@ -10,6 +10,8 @@
 namespace genericga {
 template <class T>
 std::vector<int> GetOrderings(const std::vector<T>& vec);
+std::vector<int> GetOrderings(const std::vector<float>& vec);
+void MergeOrderings(const std::vector<float>& vec, std::vector<int>& ordering);
 template <class T>
 std::vector<int> GetRankings(const std::vector<T>& vec);
 
@@ -21,6 +23,11 @@ template <class T, class Tiebreaker = std::function<int(int, int, int)>>
 auto GetRankingsWithTies(const std::vector<T>& vec,
                          Tiebreaker tiebreaker = CurrentRank)
     -> std::vector<typename std::result_of<Tiebreaker(int, int, int)>::type>;
+template <class T, class Tiebreaker>
+auto GetRankingsWithTies(const std::vector<T>& vec,
+                         const std::vector<int>& ordering,
+                         Tiebreaker tiebreaker)
+    -> std::vector<typename std::result_of<Tiebreaker(int, int, int)>::type>;
 template <class T, class Set>
 std::vector<T> KeyIntersection(const std::vector<T>& keys, const Set& set);
 template <class T, class Set>
@@ -45,16 +52,30 @@ std::vector<int> GetOrderings(const std::vector<T>& vec) {
 // would be in position 1, etc.
 template <class T>
 std::vector<int> GetRankings(const std::vector<T>& vec) {
-  return GetOrderings(GetOrderings(vec));
+  std::vector<int> ordering = GetOrderings(vec);
+  std::vector<int> rankings(ordering.size());
+  for (int i = 0; i < ordering.size(); ++i) {
+    rankings[ordering[i]] = i;
+  }
+  return rankings;
 }
 
 // Gets ranking where ties are assigned according to a tibreaker function.
 template <class T, class Tiebreaker>
 auto GetRankingsWithTies(const std::vector<T>& vec, Tiebreaker tiebreaker)
     -> std::vector<typename std::result_of<Tiebreaker(int, int, int)>::type> {
+  return GetRankingsWithTies(vec, GetOrderings(vec), tiebreaker);
+}
+
+// Same as above, but reuses an ordering of vec (as from GetOrderings) instead
+// of sorting again.
+template <class T, class Tiebreaker>
+auto GetRankingsWithTies(const std::vector<T>& vec,
+                         const std::vector<int>& ordering,
+                         Tiebreaker tiebreaker)
+    -> std::vector<typename std::result_of<Tiebreaker(int, int, int)>::type> {
   using Out = typename std::result_of<Tiebreaker(int, int, int)>::type;
   std::vector<Out> rankings(vec.size());
-  std::vector<int> ordering = GetOrderings(vec);
   auto it = ordering.begin();
   auto end = ordering.end();
   int low_rank = 0;
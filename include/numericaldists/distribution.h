@@ -5,8 +5,47 @@
 
 #include <memory>
 
+#include <eigen3/Eigen/Core>
+
 namespace numericaldists {
 
+// Whole-array evaluation of a boost distribution, used by Distribution's
+// array overloads.  The generic versions loop over the boost functions;
+// uniform, normal and exponential have vectorized closed forms.
+template <typename T>
+Eigen::ArrayXd BatchPDF(const T& dist, const Eigen::ArrayXd& xs) {
+  return xs.unaryExpr([&dist](double x) { return boost::math::pdf(dist, x); });
+}
+template <typename T>
+Eigen::ArrayXd BatchCDF(const T& dist, const Eigen::ArrayXd& xs) {
+  return xs.unaryExpr([&dist](double x) { return boost::math::cdf(dist, x); });
+}
+template <typename T>
+Eigen::ArrayXd BatchQuantile(const T& dist, const Eigen::ArrayXd& ps) {
+  return ps.unaryExpr(
+      [&dist](double p) { return boost::math::quantile(dist, p); });
+}
+
+Eigen::ArrayXd BatchPDF(const boost::math::uniform_distribution<>& dist,
+                        const Eigen::ArrayXd& xs);
+Eigen::ArrayXd BatchCDF(const boost::math::uniform_distribution<>& dist,
+                        const Eigen::ArrayXd& xs);
+Eigen::ArrayXd BatchQuantile(const boost::math::uniform_distribution<>& dist,
+                             const Eigen::ArrayXd& ps);
+Eigen::ArrayXd BatchPDF(const boost::math::normal_distribution<>& dist,
+                        const Eigen::ArrayXd& xs);
+Eigen::ArrayXd BatchCDF(const boost::math::normal_distribution<>& dist,
+                        const Eigen::ArrayXd& xs);
+Eigen::ArrayXd BatchQuantile(const boost::math::normal_distribution<>& dist,
+                             const Eigen::ArrayXd& ps);
+Eigen::ArrayXd BatchPDF(const boost::math::exponential_distribution<>& dist,
+                        const Eigen::ArrayXd& xs);
+Eigen::ArrayXd BatchCDF(const boost::math::exponential_distribution<>& dist,
+                        const Eigen::ArrayXd& xs);
+Eigen::ArrayXd BatchQuantile(
+    const boost::math::exponential_distribution<>& dist,
+    const Eigen::ArrayXd& ps);
+
 // Code adapted from Sean Parent's talk on runtime polymorphism.
 // Is an example of type erasure intended to wrap boost's distributions so that
 // I can put different distributions into a vector and use any combination of
@@ -25,6 +64,19 @@ class Distribution {
   friend float quantile(const Distribution& dist, float x) {
     return dist.self_->quantile_(x);
   }
+  // One virtual call per array rather than per element.
+  friend Eigen::ArrayXd cdf(const Distribution& dist,
+                            const Eigen::ArrayXd& xs) {
+    return dist.self_->cdf_(xs);
+  }
+  friend Eigen::ArrayXd pdf(const Distribution& dist,
+                            const Eigen::ArrayXd& xs) {
+    return dist.self_->pdf_(xs);
+  }
+  friend Eigen::ArrayXd quantile(const Distribution& dist,
+                                 const Eigen::ArrayXd& ps) {
+    return dist.self_->quantile_(ps);
+  }
 
  private:
   struct DistributionConcept {
@@ -32,6 +84,9 @@ class Distribution {
     virtual float cdf_(float x) const = 0;
     virtual float pdf_(float x) const = 0;
     virtual float quantile_(float x) const = 0;
+    virtual Eigen::ArrayXd cdf_(const Eigen::ArrayXd& xs) const = 0;
+    virtual Eigen::ArrayXd pdf_(const Eigen::ArrayXd& xs) const = 0;
+    virtual Eigen::ArrayXd quantile_(const Eigen::ArrayXd& ps) const = 0;
   };
   template <typename T>
   struct model final : DistributionConcept {
@@ -41,6 +96,15 @@ class Distribution {
     float quantile_(float x) const override {
       return boost::math::quantile(dist_, x);
     }
+    Eigen::ArrayXd cdf_(const Eigen::ArrayXd& xs) const override {
+      return BatchCDF(dist_, xs);
+    }
+    Eigen::ArrayXd pdf_(const Eigen::ArrayXd& xs) const override {
+      return BatchPDF(dist_, xs);
+    }
+    Eigen::ArrayXd quantile_(const Eigen::ArrayXd& ps) const override {
+      return BatchQuantile(dist_, ps);
+    }
     T dist_;
   };
 
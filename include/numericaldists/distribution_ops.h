@@ -5,6 +5,9 @@
 #include "numericaldists/scatter.h"
 #include "numericaldists/grid.h"
 
+#include <functional>
+#include <vector>
+
 #include <eigen3/Eigen/Core>
 
 namespace numericaldists {
@@ -63,6 +66,10 @@ Eigen::ArrayXd MarginalX(const Eigen::ArrayXd& xs, const Eigen::ArrayXd& ys,
 Eigen::ArrayXd MarginalY(const Eigen::ArrayXd& xs, const Eigen::ArrayXd& ys,
                          const Eigen::ArrayXXd& joint_pdf);
 
+// Equally weighted mixture of CDFs, resampled onto n_samples points spanning
+// all of their ranges.
+Scatter MixtureCDF(const std::vector<const Scatter*>& cdfs, int n_samples);
+
 }  // namespace numericaldists
 
 #endif  // NUMERICALDISTS_DISTRIBUTION_OPS_H_
@@ -12,6 +12,10 @@ struct Grid {
 };
 
 std::ostream& operator<<(std::ostream& os, const Grid& grid);
+
+// The xs, the ys, then zs column by column, for multipop::GA's convergence
+// checks.
+Eigen::ArrayXd StrategyValues(const Grid& grid);
 }  // namespace numericaldists
 
 #endif  // BIDDINGGA_GRID_H_
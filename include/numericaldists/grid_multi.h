@@ -16,6 +16,9 @@ struct GridMulti {
 
 std::ostream& operator<<(std::ostream& os, const GridMulti& grid);
 
+// As StrategyValues(const Grid&), with each of z_sets in turn after the ys.
+Eigen::ArrayXd StrategyValues(const GridMulti& grid);
+
 }  // namespace numericaldists
 
 #endif  // BIDDINGGA_GRID_MULTI_H_
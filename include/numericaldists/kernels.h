@@ -0,0 +1,35 @@
+#ifndef NUMERICALDISTS_KERNELS_H_
+#define NUMERICALDISTS_KERNELS_H_
+
+#include <eigen3/Eigen/Core>
+
+namespace numericaldists {
+
+// The interpolation, integration and CDF kernels behind function_ops and
+// distribution_ops, generic over the scalar type.  They are instantiated for
+// double, which the ArrayXd functions forward to, and for float, so fitness
+// scoring can run in single precision.
+template <class Scalar>
+using ArrayX = Eigen::Array<Scalar, Eigen::Dynamic, 1>;
+
+// Linear interpolation at new_xs of ys sampled evenly on [x_min, x_max].
+// new_xs outside the range are clamped to it.
+template <class Scalar>
+ArrayX<Scalar> InterpolateEven(Scalar x_min, Scalar x_max,
+                               const ArrayX<Scalar>& ys,
+                               const ArrayX<Scalar>& new_xs);
+
+// Trapezoid rule integral of ys over xs.
+template <class Scalar>
+Scalar TrapezoidIntegral(const ArrayX<Scalar>& xs, const ArrayX<Scalar>& ys);
+
+// CDF at the evenly spaced new_xs of func(X), where X has density pdf on xs
+// and func_vals holds func at xs.
+template <class Scalar>
+ArrayX<Scalar> FunctionCDF(const ArrayX<Scalar>& xs, const ArrayX<Scalar>& pdf,
+                           const ArrayX<Scalar>& func_vals,
+                           const ArrayX<Scalar>& new_xs);
+
+}  // namespace numericaldists
+
+#endif  // NUMERICALDISTS_KERNELS_H_
@@ -0,0 +1,82 @@
+#ifndef NUMERICALDISTS_PIECEWISE_LINEAR_H_
+#define NUMERICALDISTS_PIECEWISE_LINEAR_H_
+
+#include <vector>
+
+#include "numericaldists/scatter.h"
+
+#include <eigen3/Eigen/Core>
+
+namespace numericaldists {
+
+// Function that is linear between the points (xs(i), ys(i)).  Unlike a
+// Scatter, the xs may be unevenly spaced, and a repeated x marks a jump:
+// the function takes the value of the last point at that x, so CDFs with
+// atoms are right-continuous.  Outside [Lower(), Upper()] the end values are
+// held, as Interpolate does.
+class PiecewiseLinear {
+ public:
+  PiecewiseLinear() {}
+  // xs must be non-decreasing.
+  PiecewiseLinear(Eigen::ArrayXd xs, Eigen::ArrayXd ys);
+  explicit PiecewiseLinear(const Scatter& points);
+
+  double operator()(double x) const;
+  Eigen::ArrayXd operator()(const Eigen::ArrayXd& xs) const;
+  // Limit from below, which differs from operator() only at jumps.
+  double LeftLimit(double x) const;
+
+  const Eigen::ArrayXd& xs() const { return xs_; }
+  const Eigen::ArrayXd& ys() const { return ys_; }
+  bool empty() const { return xs_.size() == 0; }
+  double Lower() const { return xs_(0); }
+  double Upper() const { return xs_(xs_.size() - 1); }
+
+  // Drops interior points within tolerance of the line through their
+  // neighbours, so a sampled constant or linear function has two points.
+  PiecewiseLinear Simplified(double tolerance = 1e-9) const;
+  Scatter ToScatter() const { return {xs_, ys_}; }
+
+ private:
+  Eigen::ArrayXd xs_;
+  Eigen::ArrayXd ys_;
+};
+
+// The most points of any Gauss-Legendre rule IntegrateProduct has, and so the
+// most factors it takes: an n-point rule is exact up to degree 2n - 1.
+constexpr int kMaxGaussLegendrePoints = 5;
+constexpr int kMaxProductFactors = 2 * kMaxGaussLegendrePoints - 1;
+
+// Exact integral over [a, b] of the product of factors.  Between the merged
+// breakpoints the product is a polynomial of degree factors.size(), which a
+// Gauss-Legendre rule of matching order integrates exactly.  Takes at most
+// kMaxProductFactors factors.
+double IntegrateProduct(const std::vector<const PiecewiseLinear*>& factors,
+                        double a, double b);
+
+// outer(inner(x)).  The result is exact: its breakpoints are those of inner
+// plus every x where inner crosses a breakpoint of outer.  Where inner is
+// flat exactly at a jump of outer the result takes the middle of the jump,
+// so composing a bid CDF with a bid function splits ties evenly between two
+// players.
+PiecewiseLinear Compose(const PiecewiseLinear& outer,
+                        const PiecewiseLinear& inner);
+
+// Each of outers composed with inner, for a product of win probabilities
+// against several bidders with independent bid CDFs outers.  Halving every
+// tie would give a bidder tied with k - 1 others (1/2)^(k - 1), so where
+// inner is flat the first result holds the chance of winning with ties split
+// evenly among everyone tied, 1/k for k constant bidders, and the rest hold
+// 1.  Only the product of the results is meaningful there.
+std::vector<PiecewiseLinear> ComposeEach(
+    const std::vector<const PiecewiseLinear*>& outers,
+    const PiecewiseLinear& inner);
+
+// CDF of func(V) with V uniform on [func.Lower(), func.Upper()].  It is
+// piecewise linear with breakpoints at func's ys; flat stretches of func
+// become jumps.
+PiecewiseLinear UniformImageCDF(const PiecewiseLinear& func);
+
+}  // namespace numericaldists
+
+#endif  // NUMERICALDISTS_PIECEWISE_LINEAR_H_
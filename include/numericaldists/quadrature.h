@@ -0,0 +1,30 @@
+#ifndef NUMERICALDISTS_QUADRATURE_H_
+#define NUMERICALDISTS_QUADRATURE_H_
+
+#include <functional>
+
+#include <eigen3/Eigen/Core>
+
+namespace numericaldists {
+
+// Integrand evaluated at a batch of points, returning one value per point.
+// Batches let callers keep their Eigen-vectorised Interpolate calls.
+using ArrayFunction = std::function<Eigen::ArrayXd(const Eigen::ArrayXd&)>;
+
+struct QuadratureResult {
+  double value;
+  // Sum of the |Kronrod - Gauss| estimates over the final subintervals.
+  double error;
+  int n_evals;
+};
+
+// Adaptive 7-15 point Gauss-Kronrod integration of f over [a, b].  The
+// subinterval with the largest error estimate is bisected until the total
+// estimate is at most tolerance or max_intervals subintervals are in use.
+// Each bisection costs one 30 point batch of f.
+QuadratureResult IntegrateAdaptive(const ArrayFunction& f, double a, double b,
+                                   double tolerance, int max_intervals = 1000);
+
+}  // namespace numericaldists
+
+#endif  // NUMERICALDISTS_QUADRATURE_H_
@@ -14,6 +14,10 @@ struct Scatter {
 
 std::ostream& operator<<(std::ostream& os, const Scatter& points);
 
+// The xs then the ys, which multipop::GA compares between rounds to decide
+// whether a bid function has stopped moving.
+Eigen::ArrayXd StrategyValues(const Scatter& points);
+
 }  // namespace numericaldists
 
 #endif  // BIDDINGGA_SCATTER_H_
@@ -0,0 +1,26 @@
+#include <cstdint>
+#include <fstream>
+#include <iostream>
+
+#include "biddingga/results.h"
+
+// Prints a results file written by the drivers in their CSV layout, and the
+// run seed to stderr.
+int main(int argc, char** argv) {
+  if (argc < 2) {
+    std::cerr << "Usage: " << argv[0] << " results_file" << std::endl;
+    return 1;
+  }
+  std::ifstream in(argv[1], std::ifstream::binary);
+  std::uint64_t seed;
+  if (!biddingga::ReadResultsHeader(in, &seed)) {
+    std::cerr << argv[1] << " is not a results file" << std::endl;
+    return 1;
+  }
+  std::cerr << "seed " << seed << std::endl;
+  biddingga::ResultsSnapshot snapshot;
+  while (biddingga::ReadSnapshot(in, &snapshot)) {
+    biddingga::WriteSnapshotCSV(std::cout, snapshot);
+  }
+  return 0;
+}
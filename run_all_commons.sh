@@ -1,15 +1,10 @@
 #!/bin/bash
-for ((i=1;i<=5;i++)); 
-do
-    for ((j=i;j<=5;j++)); 
-    do
-	for ((k=j;k<=5;k++)); 
-	do
-	    for ((m=k;m<=5;m++)); 
-	    do
-		echo "bin/common_value $i $j $k $m > output/common_second_$i$j$k$m.csv"
-		bin/common_value $i $j $k $m > output/common_second_$i$j$k$m.csv
-	    done
-	done
-    done
+# Runs every configuration in common_value_sweep.txt in one bin/common_value
+# process, which writes common_value_i_j_k_m.results for each, then converts
+# them to CSV.
+bin/common_value common_value_sweep.txt || exit 1
+for f in common_value_*_*_*_*.results; do
+    draws=${f#common_value_}
+    draws=${draws%.results}
+    bin/results_to_csv $f > output/common_second_${draws//_/}.csv
 done
@@ -1,9 +1,13 @@
 #include "auctions/all_pay.h"
 
+#include <cassert>
+
+#include "auctions/best_response.h"
 #include "numericaldists/distribution.h"
 #include "numericaldists/distribution_ops.h"
 #include "numericaldists/function_ops.h"
 #include "numericaldists/order_statistic_ops.h"
+#include "numericaldists/quadrature.h"
 
 #include <omp.h>
 #include <eigen3/Eigen/Core>
@@ -20,15 +24,12 @@ AllPay::AllPay(const std::vector<Distribution>& value_dists,
       n_players_(value_dists.size()),
       n_internal_samples_(n_internal_samples),
       max_bid_(upper(value_dists)) {
-  utility_funcs_ = std::vector<std::function<double(double)>>(
-      n_players_, [](double val) { return val; });
-  prob_weight_funcs_ = std::vector<std::function<double(double)>>(
-      n_players_, [](double prob) { return prob; });
+  utility_funcs_ = std::vector<ValueTransform>(n_players_);
+  prob_weight_funcs_ = std::vector<ValueTransform>(n_players_);
   for (const auto& dist : value_dists) {
     ArrayXd values =
         ArrayXd::LinSpaced(n_internal_samples, lower(dist), upper(dist));
-    ArrayXd pdfs =
-        values.unaryExpr([&dist](double x) -> double { return pdf(dist, x); });
+    ArrayXd pdfs = pdf(dist, values);
     value_pdfs_.push_back({values, pdfs});
   }
 }
@@ -43,9 +44,23 @@ void AllPay::AcceptStrategy(const Scatter& bids, int id) {
 }
 
 float AllPay::GetFitness(const Scatter& bids_in, int id) const {
+  double low = bids_in.xs(0);
+  double high = bids_in.xs(bids_in.xs.size() - 1);
+  if (integration_tolerance_ > 0) {
+    auto integrand = [&](const ArrayXd& vals) {
+      return FitnessIntegrand(bids_in, id, vals);
+    };
+    return IntegrateAdaptive(integrand, low, high, integration_tolerance_)
+        .value;
+  }
   ArrayXd integrate_vals =
-      ArrayXd::LinSpaced((bids_in.xs.size() - 1) * 3, bids_in.xs(0),
-                         bids_in.xs(bids_in.xs.size() - 1));
+      ArrayXd::LinSpaced((bids_in.xs.size() - 1) * 3, low, high);
+  return Areas(integrate_vals, FitnessIntegrand(bids_in, id, integrate_vals))
+      .sum();
+}
+
+ArrayXd AllPay::FitnessIntegrand(const Scatter& bids_in, int id,
+                                const ArrayXd& integrate_vals) const {
   ArrayXd bids = Interpolate(bids_in, integrate_vals);
   ArrayXd profits = integrate_vals - bids;
   ArrayXd win_probs = ArrayXd::Ones(integrate_vals.size());
@@ -54,12 +69,10 @@ float AllPay::GetFitness(const Scatter& bids_in, int id) const {
       win_probs *= Interpolate(bid_cdfs_[j], bids);
     }
   }
-  ArrayXd utils = profits.unaryExpr(utility_funcs_[id]) *
-                      win_probs.unaryExpr(prob_weight_funcs_[id]) +
-                  (-bids).unaryExpr(utility_funcs_[id]) *
-                      (1 - win_probs).unaryExpr(prob_weight_funcs_[id]);
+  ArrayXd utils = ExpectedUtility(utility_funcs_[id], prob_weight_funcs_[id],
+                                  profits, win_probs, -bids);
   ArrayXd likelihoods = Interpolate(value_pdfs_[id], integrate_vals);
-  return Areas(integrate_vals, utils * likelihoods).sum();
+  return utils * likelihoods;
 }
 
 float AllPay::GetRevenue(const Scatter& bids_in, int id) const {
@@ -94,4 +107,37 @@ float AllPay::GetValue(const Scatter& bids_in, int id) const {
   return Areas(integrate_vals, realized_values * likelihoods).sum();
 }
 
+Scatter AllPay::BestResponse(int id, int n_values, int n_bids) const {
+  const ArrayXd& value_xs = value_pdfs_[id].xs;
+  ArrayXd values =
+      ArrayXd::LinSpaced(n_values, value_xs(0), value_xs(value_xs.size() - 1));
+  ArrayXd bids = ArrayXd::LinSpaced(n_bids, 0, max_bid_);
+  ArrayXd win_probs = ArrayXd::Ones(n_bids);
+  for (int j = 0; j < n_players_; ++j) {
+    if (j != id) {
+      win_probs *= Interpolate(bid_cdfs_[j], bids);
+    }
+  }
+  // Rows are values and columns bids.
+  ArrayXXd bid_mesh = bids.transpose().replicate(n_values, 1);
+  ArrayXXd profits = values.replicate(1, n_bids) - bid_mesh;
+  ArrayXXd utils = ExpectedUtility(
+      utility_funcs_[id], prob_weight_funcs_[id], profits,
+      win_probs.transpose().replicate(n_values, 1), -bid_mesh);
+  return {values, BestBids(utils, bids)};
+}
+
+AllPay AllPay::Mix(const std::vector<AllPay*>& envs) {
+  assert(!envs.empty());
+  AllPay mixed = *envs[0];
+  for (int j = 0; j < mixed.n_players_; ++j) {
+    std::vector<const Scatter*> cdfs;
+    for (auto env : envs) {
+      cdfs.push_back(&env->bid_cdfs_[j]);
+    }
+    mixed.bid_cdfs_[j] = MixtureCDF(cdfs, mixed.n_internal_samples_);
+  }
+  return mixed;
+}
+
 }  // namespace auctions
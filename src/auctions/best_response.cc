@@ -0,0 +1,28 @@
+#include "auctions/best_response.h"
+
+#include <cassert>
+#include <limits>
+
+using namespace Eigen;
+
+namespace auctions {
+
+ArrayXd BestBids(const ArrayXXd& utilities, const ArrayXd& bids) {
+  assert(utilities.cols() == bids.size());
+  ArrayXd best = ArrayXd::Constant(utilities.rows(), bids(0));
+  ArrayXd best_utilities = ArrayXd::Constant(
+      utilities.rows(), -std::numeric_limits<double>::infinity());
+  // Column by column, so the scan runs down contiguous memory.  NaN
+  // utilities, such as a price conditional on never winning, never win.
+  for (int j = 0; j < utilities.cols(); ++j) {
+    for (int i = 0; i < utilities.rows(); ++i) {
+      if (utilities(i, j) > best_utilities(i)) {
+        best_utilities(i) = utilities(i, j);
+        best(i) = bids(j);
+      }
+    }
+  }
+  return best;
+}
+
+}  // namespace auctions
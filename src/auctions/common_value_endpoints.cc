@@ -24,10 +24,8 @@ CommonValueEndpoints::CommonValueEndpoints(int n_bidders,
       pre_calculated_(false),
       others_bids_cdfs_(n_bidders),
       bid_funcs_(n_bidders) {
-  utility_funcs_ = std::vector<std::function<double(double)>>(
-      n_players_, [](double val) { return val; });
-  prob_weight_funcs_ = std::vector<std::function<double(double)>>(
-      n_players_, [](double prob) { return prob; });
+  utility_funcs_ = std::vector<ValueTransform>(n_players_);
+  prob_weight_funcs_ = std::vector<ValueTransform>(n_players_);
   internal_bids_ = ArrayXd::LinSpaced(n_internal_samples,
                                       lower(value_dist) + lower(error_dist),
                                       upper(value_dist) + upper(error_dist));
@@ -39,10 +37,8 @@ CommonValueEndpoints::CommonValueEndpoints(int n_bidders,
                                          upper(value_dist) + upper(error_dist));
   ArrayXd internal_errors = ArrayXd::LinSpaced(
       n_internal_samples, lower(error_dist), upper(error_dist));
-  ArrayXd error_pdf = internal_errors.unaryExpr(
-      [&error_dist](double x) -> double { return pdf(error_dist, x); });
-  ArrayXd value_pdf = internal_values_.unaryExpr(
-      [&value_dist](double x) -> double { return pdf(value_dist, x); });
+  ArrayXd error_pdf = pdf(error_dist, internal_errors);
+  ArrayXd value_pdf = pdf(value_dist, internal_values_);
   ArrayXXd temp_joint = JointPDFIndependent(value_pdf, error_pdf);
   ArrayXXd value_mesh = GetXMesh(internal_values_, internal_errors.size());
   ArrayXXd error_mesh = GetYMesh(internal_errors, internal_values_.size());
@@ -50,7 +46,8 @@ CommonValueEndpoints::CommonValueEndpoints(int n_bidders,
   ArrayXXd value_cdf = TwoRandomVariableFunctionCDF(
       internal_values_, internal_errors, temp_joint, value_mesh, signal_mesh,
       internal_values_, internal_signals_);
-  value_pdf_ = PDF2D(internal_values_, internal_signals_, value_cdf);
+  value_pdf_ = std::make_shared<const ArrayXXd>(
+      PDF2D(internal_values_, internal_signals_, value_cdf));
 }
 
 void CommonValueEndpoints::AcceptStrategy(Scatter bid_func, int id) {
@@ -67,7 +64,7 @@ float CommonValueEndpoints::GetFitness(const Scatter& bid_func, int id) const {
       ArrayXd::LinSpaced((bid_func.xs.size() - 1) * 3, bid_func.xs(0),
                          bid_func.xs(bid_func.xs.size() - 1));
   ArrayXXd likelihoods =
-      Interpolate2D(internal_values_, internal_signals_, value_pdf_,
+      Interpolate2D(internal_values_, internal_signals_, *value_pdf_,
                     internal_values_, integration_signals);
 
   ArrayXd bids = Interpolate(bid_func, integration_signals);
@@ -80,14 +77,16 @@ float CommonValueEndpoints::GetFitness(const Scatter& bid_func, int id) const {
   }
 
   ArrayXXd utils =
-      profits.unaryExpr(utility_funcs_[id]) *
-          win_probs.unaryExpr(prob_weight_funcs_[id]) +
-      utility_funcs_[id](0) * (1 - win_probs).unaryExpr(prob_weight_funcs_[id]);
+      ExpectedUtility(utility_funcs_[id], prob_weight_funcs_[id], profits,
+                      win_probs);
   return Areas2D(internal_values_, integration_signals, utils * likelihoods)
       .sum();
 }
 
 void CommonValueEndpoints::Precalculate() const {
+  if (pre_calculated_) {
+    return;
+  }
   std::vector<ArrayXd> bid_sets;
   for (int i = 0; i < n_players_; ++i) {
     bid_sets.push_back(Interpolate(bid_funcs_[i], internal_signals_));
@@ -102,9 +101,9 @@ void CommonValueEndpoints::Precalculate() const {
     std::vector<ArrayXd> cdfs(n_players_,
                               ArrayXd::Zero(internal_signals_.size()));
     for (int i = 0; i < n_players_; ++i) {
-      if (value_pdf_.col(v).sum() > 0) {
+      if (value_pdf_->col(v).sum() > 0) {
         cdfs[i] = RandomVariableFunctionCDF(
-            internal_signals_, value_pdf_.col(v), bid_sets[i], internal_bids_);
+            internal_signals_, value_pdf_->col(v), bid_sets[i], internal_bids_);
       }
     }
     for (int i = 0; i < n_players_; ++i) {
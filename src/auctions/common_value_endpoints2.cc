@@ -22,10 +22,8 @@ CommonValueEndpoints2::CommonValueEndpoints2(int n_bidders,
       others_bids_cdfs_(n_bidders),
       bid_funcs_(n_bidders),
       error_dist_(error_dist) {
-  utility_funcs_ = std::vector<std::function<double(double)>>(
-      n_players_, [](double val) { return val; });
-  prob_weight_funcs_ = std::vector<std::function<double(double)>>(
-      n_players_, [](double prob) { return prob; });
+  utility_funcs_ = std::vector<ValueTransform>(n_players_);
+  prob_weight_funcs_ = std::vector<ValueTransform>(n_players_);
   internal_bids_ = ArrayXd::LinSpaced(n_internal_samples,
                                       lower(value_dist) + lower(error_dist),
                                       upper(value_dist) + upper(error_dist));
@@ -38,8 +36,7 @@ CommonValueEndpoints2::CommonValueEndpoints2(int n_bidders,
 
   ArrayXd internal_errors = ArrayXd::LinSpaced(
       n_internal_samples, lower(error_dist), upper(error_dist));
-  value_pdf_ = internal_values_.unaryExpr(
-      [&value_dist](double x) -> double { return pdf(value_dist, x); });
+  value_pdf_ = pdf(value_dist, internal_values_);
 }
 
 void CommonValueEndpoints2::AcceptStrategy(Scatter bid_func, int id) {
@@ -62,24 +59,23 @@ float CommonValueEndpoints2::GetFitness(const Scatter& bid_func, int id) const {
   ArrayXd bids = Interpolate(bid_func, integration_signals);
   for (int v = 0; v < internal_values_.size(); ++v) {
     ArrayXd error_likelihoods =
-        (integration_signals - internal_values_[v])
-            .unaryExpr([&error_dist](double x) -> double {
-              return pdf(error_dist, x);
-            });
+        pdf(error_dist, integration_signals - internal_values_[v]);
     likelihoods.col(v) = value_likelihoods[v] * error_likelihoods;
     win_probs.col(v) =
         Interpolate(internal_bids_, others_bids_cdfs_[id].col(v), bids);
     profits.col(v) = internal_values_[v] - bids;
   }
   ArrayXXd utils =
-      profits.unaryExpr(utility_funcs_[id]) *
-          win_probs.unaryExpr(prob_weight_funcs_[id]) +
-      utility_funcs_[id](0) * (1 - win_probs).unaryExpr(prob_weight_funcs_[id]);
+      ExpectedUtility(utility_funcs_[id], prob_weight_funcs_[id], profits,
+                      win_probs);
   return Areas2D(internal_values_, integration_signals, utils * likelihoods)
       .sum();
 }
 
 void CommonValueEndpoints2::Precalculate() const {
+  if (pre_calculated_) {
+    return;
+  }
   std::vector<ArrayXd> bid_sets;
   for (int i = 0; i < n_players_; ++i) {
     bid_sets.push_back(Interpolate(bid_funcs_[i], internal_signals_));
@@ -92,10 +88,7 @@ void CommonValueEndpoints2::Precalculate() const {
 #pragma omp parallel for
   for (int v = 0; v < internal_values_.size(); ++v) {
     ArrayXd error_likelihoods =
-        (internal_signals_ - internal_values_[v])
-            .unaryExpr([&error_dist](double x) -> double {
-              return pdf(error_dist, x);
-            });
+        pdf(error_dist, internal_signals_ - internal_values_[v]);
     std::vector<ArrayXd> cdfs(n_players_,
                               ArrayXd::Zero(internal_signals_.size()));
     if (value_pdf_(v) > 0) {
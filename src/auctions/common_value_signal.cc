@@ -5,9 +5,12 @@
 #include <algorithm>
 
 #include <boost/math/distributions/uniform.hpp>
+#include "auctions/signal_value_dist.h"
+#include "genericga/checkpoint.h"
 #include "numericaldists/distribution_ops.h"
 #include "numericaldists/function_ops.h"
 #include "numericaldists/order_statistic_ops.h"
+#include "numericaldists/quadrature.h"
 
 using namespace boost::math;
 using namespace numericaldists;
@@ -25,13 +28,10 @@ CommonValueSignal::CommonValueSignal(std::vector<int> n_draws, float epsilon,
       rel_bid_funcs_(n_draws.size()),
       one_draw_rel_bids_(n_draws.size()),
       others_bids_cdfs_(n_draws.size()),
-      value_dists_(n_draws.size()),
       n_internal_samples_(n_internal_samples),
       mstar_integration_samples_(mstar_integration_samples) {
-  utility_funcs_ = std::vector<std::function<double(double)>>(
-      n_players_, [](double val) { return val; });
-  prob_weight_funcs_ = std::vector<std::function<double(double)>>(
-      n_players_, [](double prob) { return prob; });
+  utility_funcs_ = std::vector<ValueTransform>(n_players_);
+  prob_weight_funcs_ = std::vector<ValueTransform>(n_players_);
   internal_bids_ =
       ArrayXd::LinSpaced(n_internal_samples_, -epsilon + rel_bid_int.min,
                          epsilon + rel_bid_int.max);
@@ -40,20 +40,11 @@ CommonValueSignal::CommonValueSignal(std::vector<int> n_draws, float epsilon,
   internal_mstars_ = ArrayXd::LinSpaced(n_internal_samples_, -epsilon, epsilon);
   internal_precs_ = ArrayXd::LinSpaced(n_internal_samples_, 0, 2 * epsilon);
   one_draw_pdf_ = ArrayXd::Ones(n_internal_samples, 1) / (2 * epsilon);
-  ArrayXd signal_cdf = ArrayXd::LinSpaced(n_internal_samples_, 0, 1);
-  ArrayXXd signalXMesh = GetXMesh(internal_signals_, internal_signals_.size());
-  ArrayXXd signalYMesh = GetYMesh(internal_signals_, internal_signals_.size());
-  ArrayXXd mstarMesh = (signalXMesh + signalYMesh) / 2;
-  ArrayXXd precMesh = (signalYMesh - signalXMesh).abs();
+  value_dists_.resize(n_players_);
   for (int i = 0; i < n_players_; ++i) {
-    int draw = n_draws_[i];
-    if (draw > 1) {
-      ArrayXXd joint = LowestHighestJointOrderStatisticPDF(internal_signals_,
-                                                           signal_cdf, draw);
-      ArrayXXd joint_m_r_cdf = TwoRandomVariableFunctionCDF(
-          internal_signals_, internal_signals_, joint, mstarMesh, precMesh,
-          internal_mstars_, internal_precs_);
-      value_dists_[i] = PDF2D(internal_mstars_, internal_precs_, joint_m_r_cdf);
+    if (n_draws_[i] > 1) {
+      value_dists_[i] =
+          SharedMidpointSpreadPDF(n_draws_[i], epsilon, n_internal_samples_);
     }
   }
 }
@@ -68,6 +59,24 @@ void CommonValueSignal::AcceptStrategy(float rel_bid_value, int id) {
   pre_calculated_ = false;
 }
 
+void CommonValueSignal::SaveCheckpoint(std::ostream& os) const {
+  for (const auto& rel_bid_func : rel_bid_funcs_) {
+    genericga::WriteBinary(os, rel_bid_func.xs);
+    genericga::WriteBinary(os, rel_bid_func.ys);
+  }
+  genericga::WriteBinary(os, one_draw_rel_bids_);
+}
+
+void CommonValueSignal::LoadCheckpoint(std::istream& is) {
+  for (auto& rel_bid_func : rel_bid_funcs_) {
+    genericga::ReadBinary(is, &rel_bid_func.xs);
+    genericga::ReadBinary(is, &rel_bid_func.ys);
+  }
+  genericga::ReadBinary(is, &one_draw_rel_bids_);
+  CheckLoadedStrategies(rel_bid_funcs_, one_draw_rel_bids_, internal_precs_);
+  pre_calculated_ = false;
+}
+
 // rel_bid_func -- x-values are different precisions, y-values are the bid
 // relative to mstar given the precision
 float CommonValueSignal::GetFitness(const Scatter& rel_bid_func, int id) const {
@@ -95,11 +104,10 @@ float CommonValueSignal::GetFitness(const Scatter& rel_bid_func, int id) const {
   // True value is the reference point, so it is 0.
   ArrayXXd profits = 0 - bids;
   ArrayXXd utils =
-      profits.unaryExpr(utility_funcs_[id]) *
-          win_probs.unaryExpr(prob_weight_funcs_[id]) +
-      utility_funcs_[id](0) * (1 - win_probs).unaryExpr(prob_weight_funcs_[id]);
+      ExpectedUtility(utility_funcs_[id], prob_weight_funcs_[id], profits,
+                      win_probs);
   ArrayXXd likelihoods =
-      Interpolate2D(internal_mstars_, internal_precs_, value_dists_[id],
+      Interpolate2D(internal_mstars_, internal_precs_, *value_dists_[id],
                     integrate_mstars, integrate_precs);
   return Areas2D(integrate_mstars, integrate_precs, utils * likelihoods).sum();
 }
@@ -109,22 +117,34 @@ float CommonValueSignal::GetFitness(const float rel_bid, int id) const {
     Precalculate();
   }
 
+  auto integrand = [&](const ArrayXd& signals) {
+    ArrayXd bids = signals + rel_bid;
+    ArrayXd win_probs =
+        Interpolate(internal_bids_, others_bids_cdfs_[id], bids);
+    ArrayXd profits = 0 - bids;
+    ArrayXd utils =
+        ExpectedUtility(utility_funcs_[id], prob_weight_funcs_[id], profits,
+                        win_probs);
+    ArrayXd likelihoods =
+        Interpolate(internal_signals_, one_draw_pdf_, signals);
+    return ArrayXd(utils * likelihoods);
+  };
+
+  double low = internal_signals_(0);
+  double high = internal_signals_(internal_signals_.size() - 1);
+  if (integration_tolerance_ > 0) {
+    return IntegrateAdaptive(integrand, low, high, integration_tolerance_)
+        .value;
+  }
   ArrayXd integrate_signals =
-      ArrayXd::LinSpaced(mstar_integration_samples_, internal_signals_(0),
-                         internal_signals_(internal_signals_.size() - 1));
-  ArrayXd bids = integrate_signals + rel_bid;
-  ArrayXd win_probs = Interpolate(internal_bids_, others_bids_cdfs_[id], bids);
-  ArrayXd profits = 0 - bids;
-  ArrayXd utils =
-      profits.unaryExpr(utility_funcs_[id]) *
-          win_probs.unaryExpr(prob_weight_funcs_[id]) +
-      utility_funcs_[id](0) * (1 - win_probs).unaryExpr(prob_weight_funcs_[id]);
-  ArrayXd likelihoods =
-      Interpolate(internal_signals_, one_draw_pdf_, integrate_signals);
-  return Areas(integrate_signals, utils * likelihoods).sum();
+      ArrayXd::LinSpaced(mstar_integration_samples_, low, high);
+  return Areas(integrate_signals, integrand(integrate_signals)).sum();
 }
 
 void CommonValueSignal::Precalculate() const {
+  if (pre_calculated_) {
+    return;
+  }
   std::vector<ArrayXd> cdfs(n_players_);
 
   #pragma omp parallel for
@@ -139,7 +159,7 @@ void CommonValueSignal::Precalculate() const {
       ArrayXXd bid_mesh = mstar_mesh + rel_bid_mesh;
       cdfs[i] =
           RandomVariableFunctionCDF(internal_mstars_, internal_precs_,
-                                    value_dists_[i], bid_mesh, internal_bids_);
+                                    *value_dists_[i], bid_mesh, internal_bids_);
     } else {
       ArrayXd bids = internal_mstars_ + one_draw_rel_bids_[i];
       cdfs[i] = RandomVariableFunctionCDF(internal_mstars_, one_draw_pdf_, bids,
@@ -17,8 +17,9 @@ namespace auctions {
 ArrayXXd CommonValueSignalEndpoints::GetSignalPDF(int id, int value_index,
                                                   ArrayXd midpoints,
                                                   ArrayXd uncertainties) const {
-  return Interpolate2D(relative_pdfs_[id].xs + internal_values_[value_index],
-                       relative_pdfs_[id].ys, relative_pdfs_[id].zs, midpoints,
+  const Grid& relative_pdf = (*relative_pdfs_)[id];
+  return Interpolate2D(relative_pdf.xs + internal_values_[value_index],
+                       relative_pdf.ys, relative_pdf.zs, midpoints,
                        uncertainties);
 }
 
@@ -33,7 +34,6 @@ CommonValueSignalEndpoints::CommonValueSignalEndpoints(
       bid_funcs_(n_draws.size()),
       one_draw_bids_(n_draws.size()),
       others_bids_cdfs_(n_draws.size()),
-      relative_pdfs_(n_draws.size()),
       error_dist_(error_dist) {
   double min_error = error_dist.lower();
   double max_error = error_dist.upper();
@@ -53,25 +53,22 @@ CommonValueSignalEndpoints::CommonValueSignalEndpoints(
 
   ArrayXd internal_errors =
       ArrayXd::LinSpaced(n_internal_samples_, min_error, max_error);
-  value_pdf_ = internal_values_.unaryExpr(
-      [&value_dist](double x) -> double { return pdf(value_dist, x); });
-  utility_funcs_ = std::vector<std::function<double(double)>>(
-      n_players_, [](double val) { return val; });
-  prob_weight_funcs_ = std::vector<std::function<double(double)>>(
-      n_players_, [](double prob) { return prob; });
+  value_pdf_ = BatchPDF(value_dist, internal_values_);
+  utility_funcs_ = std::vector<ValueTransform>(n_players_);
+  prob_weight_funcs_ = std::vector<ValueTransform>(n_players_);
 
   double buffer = 0.05 * error_range;
   ArrayXd rel_midpoints = ArrayXd::LinSpaced(
       n_internal_samples_, min_error - buffer, max_error + buffer);
   ArrayXd buffered_unc =
       ArrayXd::LinSpaced(n_internal_samples_, 0, error_range + 2 * buffer);
-  ArrayXd rel_midpoint_cdf = rel_midpoints.unaryExpr(
-      [&error_dist](double x) -> double { return cdf(error_dist, x); });
+  ArrayXd rel_midpoint_cdf = BatchCDF(error_dist, rel_midpoints);
   ArrayXXd min_midpoint_mesh = GetXMesh(rel_midpoints, n_internal_samples_);
   ArrayXXd max_midpoint_mesh = GetYMesh(rel_midpoints, n_internal_samples_);
   ArrayXXd midpoint_mesh = (min_midpoint_mesh + max_midpoint_mesh) / 2;
   ArrayXXd unc_mesh =
       error_range - (max_midpoint_mesh - min_midpoint_mesh).abs();
+  std::vector<Grid> relative_pdfs(n_players_);
   for (int i = 0; i < n_players_; ++i) {
     int draw = n_draws_[i];
     if (draw > 1) {
@@ -80,10 +77,12 @@ CommonValueSignalEndpoints::CommonValueSignalEndpoints(
       ArrayXXd joint_m_r_cdf = TwoRandomVariableFunctionCDF(
           rel_midpoints, rel_midpoints, joint, midpoint_mesh, unc_mesh,
           rel_midpoints, buffered_unc);
-      relative_pdfs_[i] = {rel_midpoints, buffered_unc,
-                           PDF2D(rel_midpoints, buffered_unc, joint_m_r_cdf)};
+      relative_pdfs[i] = {rel_midpoints, buffered_unc,
+                          PDF2D(rel_midpoints, buffered_unc, joint_m_r_cdf)};
     }
   }
+  relative_pdfs_ =
+      std::make_shared<const std::vector<Grid>>(std::move(relative_pdfs));
 }
 
 void CommonValueSignalEndpoints::AcceptStrategy(Grid bid_func, int id) {
@@ -136,10 +135,9 @@ float CommonValueSignalEndpoints::GetFitness(const Grid& bid_func,
         GetSignalPDF(id, v, integration_midpoints, integration_uncertainties);
     ArrayXXd likelihoods = value_likelihoods[v] * signal_likelihoods;
     ArrayXXd profits = internal_values_[v] - bids;
-    ArrayXXd utils = profits.unaryExpr(utility_funcs_[id]) *
-                         win_probs.unaryExpr(prob_weight_funcs_[id]) +
-                     utility_funcs_[id](0) *
-                         (1 - win_probs).unaryExpr(prob_weight_funcs_[id]);
+    ArrayXXd utils =
+        ExpectedUtility(utility_funcs_[id], prob_weight_funcs_[id], profits,
+                        win_probs);
     sub_areas(v) = Areas2D(integration_midpoints, integration_uncertainties,
                            utils * likelihoods)
                        .sum();
@@ -176,24 +174,24 @@ float CommonValueSignalEndpoints::GetFitness(const Scatter& bid_func,
     if (v > 0 && internal_values_(v - 1) > max_integration_value) {
       break;
     }
-    ArrayXd error_likelihoods = (integration_midpoints - internal_values_[v])
-                                    .unaryExpr([this](double x) -> double {
-                                      return pdf(error_dist_, x);
-                                    });
+    ArrayXd error_likelihoods =
+        BatchPDF(error_dist_, integration_midpoints - internal_values_[v]);
     likelihoods.col(v) = value_likelihoods[v] * error_likelihoods;
     win_probs.col(v) =
         Interpolate(internal_bids_, others_bids_cdfs_[id].col(v), bids);
     profits.col(v) = internal_values_[v] - bids;
   }
   ArrayXXd utils =
-      profits.unaryExpr(utility_funcs_[id]) *
-          win_probs.unaryExpr(prob_weight_funcs_[id]) +
-      utility_funcs_[id](0) * (1 - win_probs).unaryExpr(prob_weight_funcs_[id]);
+      ExpectedUtility(utility_funcs_[id], prob_weight_funcs_[id], profits,
+                      win_probs);
   return Areas2D(internal_values_, integration_midpoints, utils * likelihoods)
       .sum();
 }
 
 void CommonValueSignalEndpoints::Precalculate() const {
+  if (pre_calculated_) {
+    return;
+  }
   std::vector<ArrayXXd> bid_sets(n_players_);
   std::vector<ArrayXd> one_draw_bid_sets(n_players_);
   for (int i = 0; i < n_players_; ++i) {
@@ -220,10 +218,7 @@ void CommonValueSignalEndpoints::Precalculate() const {
               bid_sets[i], internal_bids_);
         } else {
           ArrayXd error_likelihoods =
-              (internal_midpoints_ - internal_values_[v])
-                  .unaryExpr([this](double x) -> double {
-                    return pdf(error_dist_, x);
-                  });
+              BatchPDF(error_dist_, internal_midpoints_ - internal_values_[v]);
           cdfs[i] =
               RandomVariableFunctionCDF(internal_midpoints_, error_likelihoods,
                                         one_draw_bid_sets[i], internal_bids_);
@@ -1,12 +1,18 @@
 #include "auctions/first_price.h"
 
 #include <algorithm>
+#include <cassert>
+#include <cmath>
 #include <iostream>
 
+#include "auctions/best_response.h"
 #include "numericaldists/distribution.h"
 #include "numericaldists/distribution_ops.h"
 #include "numericaldists/function_ops.h"
+#include "numericaldists/kernels.h"
 #include "numericaldists/order_statistic_ops.h"
+#include "numericaldists/piecewise_linear.h"
+#include "numericaldists/quadrature.h"
 
 #include <omp.h>
 #include <eigen3/Eigen/Core>
@@ -17,22 +23,31 @@ using namespace Eigen;
 
 namespace auctions {
 
+namespace {
+
+// GetExactFitness integrates a product with one factor per player: the
+// player's profit and each other player's win probability.
+constexpr int kMaxExactPlayers = kMaxProductFactors;
+
+}  // namespace
+
 FirstPrice::FirstPrice(const std::vector<Distribution>& value_dists,
                        int n_internal_samples)
     : bid_cdfs_(value_dists.size()),
+      exact_bid_cdfs_(value_dists.size()),
       n_players_(value_dists.size()),
       n_internal_samples_(n_internal_samples),
       max_bid_(upper(value_dists)) {
-  utility_funcs_ = std::vector<std::function<double(double)>>(
-      n_players_, [](double val) { return val; });
-  prob_weight_funcs_ = std::vector<std::function<double(double)>>(
-      n_players_, [](double prob) { return prob; });
+  utility_funcs_ = std::vector<ValueTransform>(n_players_);
+  prob_weight_funcs_ = std::vector<ValueTransform>(n_players_);
   for (const auto& dist : value_dists) {
     ArrayXd values =
         ArrayXd::LinSpaced(n_internal_samples, lower(dist), upper(dist));
-    ArrayXd pdfs =
-        values.unaryExpr([&dist](double x) -> double { return pdf(dist, x); });
+    ArrayXd pdfs = pdf(dist, values);
     value_pdfs_.push_back({values, pdfs});
+    PiecewiseLinear pdf = PiecewiseLinear(value_pdfs_.back()).Simplified();
+    bool uniform = pdf.xs().size() == 2 && pdf.ys()(0) == pdf.ys()(1);
+    uniform_densities_.push_back(uniform ? pdf.ys()(0) : 0);
   }
 }
 
@@ -43,12 +58,122 @@ void FirstPrice::AcceptStrategy(const Scatter& bids, int id) {
   ArrayXd cdf = RandomVariableFunctionCDF(
       value_pdfs_[id].xs, value_pdfs_[id].ys, interp_bids, bid_range);
   bid_cdfs_[id] = {bid_range, cdf};
+  exact_bid_cdfs_[id] = CoversUniformValues(bids, id)
+                            ? UniformImageCDF(PiecewiseLinear(bids))
+                            : PiecewiseLinear();
+  if (single_precision_) {
+    UpdateSingle(id);
+  }
+}
+
+void FirstPrice::SetSinglePrecision(bool single_precision) {
+  single_precision_ = single_precision;
+  value_pdfs_single_.assign(single_precision ? n_players_ : 0, ArrayXf());
+  bid_cdfs_single_.assign(single_precision ? n_players_ : 0, ArrayXf());
+  for (int id = 0; single_precision && id < n_players_; ++id) {
+    UpdateSingle(id);
+  }
+}
+
+void FirstPrice::UpdateSingle(int id) {
+  value_pdfs_single_[id] = value_pdfs_[id].ys.cast<float>();
+  bid_cdfs_single_[id] = bid_cdfs_[id].ys.cast<float>();
+}
+
+bool FirstPrice::CoversUniformValues(const Scatter& bids, int id) const {
+  const ArrayXd& values = value_pdfs_[id].xs;
+  double slack = 1e-6 * (values(values.size() - 1) - values(0));
+  double low_gap = std::abs(bids.xs(0) - values(0));
+  double high_gap =
+      std::abs(bids.xs(bids.xs.size() - 1) - values(values.size() - 1));
+  return uniform_densities_[id] > 0 && low_gap < slack && high_gap < slack;
+}
+
+bool FirstPrice::HasExactFitness(const Scatter& bids, int id) const {
+  if (n_players_ > kMaxExactPlayers || !CoversUniformValues(bids, id) ||
+      !utility_funcs_[id].IsIdentity() ||
+      !prob_weight_funcs_[id].IsIdentity()) {
+    return false;
+  }
+  for (int j = 0; j < n_players_; ++j) {
+    if (j != id && exact_bid_cdfs_[j].empty()) {
+      return false;
+    }
+  }
+  return true;
+}
+
+// For a risk-neutral player without probability weighting the fitness is
+//   density * integral of (v - b(v)) * prod_j F_j(b(v)) dv,
+// and every factor is piecewise linear, so it is integrated exactly.
+float FirstPrice::GetExactFitness(const Scatter& bids_in, int id) const {
+  PiecewiseLinear bids(bids_in);
+  PiecewiseLinear profits(bids_in.xs, bids_in.xs - bids_in.ys);
+  std::vector<const PiecewiseLinear*> bid_cdfs;
+  for (int j = 0; j < n_players_; ++j) {
+    if (j != id) {
+      bid_cdfs.push_back(&exact_bid_cdfs_[j]);
+    }
+  }
+  std::vector<PiecewiseLinear> win_probs = ComposeEach(bid_cdfs, bids);
+  std::vector<const PiecewiseLinear*> factors{&profits};
+  for (const auto& win_prob : win_probs) {
+    factors.push_back(&win_prob);
+  }
+  return uniform_densities_[id] *
+         IntegrateProduct(factors, bids.Lower(), bids.Upper());
 }
 
 float FirstPrice::GetFitness(const Scatter& bids_in, int id) const {
+  double low = bids_in.xs(0);
+  double high = bids_in.xs(bids_in.xs.size() - 1);
+  if (integration_tolerance_ > 0) {
+    auto integrand = [&](const ArrayXd& vals) {
+      return FitnessIntegrand(bids_in, id, vals);
+    };
+    return IntegrateAdaptive(integrand, low, high, integration_tolerance_)
+        .value;
+  }
+  if (HasExactFitness(bids_in, id)) {
+    return GetExactFitness(bids_in, id);
+  }
+  if (single_precision_) {
+    return GetSingleFitness(bids_in, id);
+  }
   ArrayXd integrate_vals =
-      ArrayXd::LinSpaced((bids_in.xs.size() - 1) * 3, bids_in.xs(0),
-                         bids_in.xs(bids_in.xs.size() - 1));
+      ArrayXd::LinSpaced((bids_in.xs.size() - 1) * 3, low, high);
+  return Areas(integrate_vals, FitnessIntegrand(bids_in, id, integrate_vals))
+      .sum();
+}
+
+// FitnessIntegrand and the trapezoid sum on the same grid, in float.
+float FirstPrice::GetSingleFitness(const Scatter& bids_in, int id) const {
+  int last = bids_in.xs.size() - 1;
+  float low = bids_in.xs(0);
+  float high = bids_in.xs(last);
+  ArrayXf integrate_vals = ArrayXf::LinSpaced(last * 3, low, high);
+  ArrayXf bid_ys = bids_in.ys.cast<float>();
+  ArrayXf bids = InterpolateEven(low, high, bid_ys, integrate_vals);
+  ArrayXf profits = integrate_vals - bids;
+  ArrayXf win_probs = ArrayXf::Ones(integrate_vals.size());
+  for (int j = 0; j < n_players_; ++j) {
+    if (j != id) {
+      const ArrayXd& cdf_xs = bid_cdfs_[j].xs;
+      win_probs *= InterpolateEven<float>(cdf_xs(0), cdf_xs(cdf_xs.size() - 1),
+                                          bid_cdfs_single_[j], bids);
+    }
+  }
+  ArrayXf utils = ExpectedUtility(utility_funcs_[id], prob_weight_funcs_[id],
+                                  profits, win_probs);
+  const ArrayXd& value_xs = value_pdfs_[id].xs;
+  ArrayXf likelihoods = InterpolateEven<float>(
+      value_xs(0), value_xs(value_xs.size() - 1), value_pdfs_single_[id],
+      integrate_vals);
+  return TrapezoidIntegral<float>(integrate_vals, utils * likelihoods);
+}
+
+ArrayXd FirstPrice::FitnessIntegrand(const Scatter& bids_in, int id,
+                                    const ArrayXd& integrate_vals) const {
   ArrayXd bids = Interpolate(bids_in, integrate_vals);
   ArrayXd profits = integrate_vals - bids;
   ArrayXd win_probs = ArrayXd::Ones(integrate_vals.size());
@@ -58,11 +183,10 @@ float FirstPrice::GetFitness(const Scatter& bids_in, int id) const {
     }
   }
   ArrayXd utils =
-      profits.unaryExpr(utility_funcs_[id]) *
-          win_probs.unaryExpr(prob_weight_funcs_[id]) +
-      utility_funcs_[id](0) * (1 - win_probs).unaryExpr(prob_weight_funcs_[id]);
+      ExpectedUtility(utility_funcs_[id], prob_weight_funcs_[id], profits,
+                      win_probs);
   ArrayXd likelihoods = Interpolate(value_pdfs_[id], integrate_vals);
-  return Areas(integrate_vals, utils * likelihoods).sum();
+  return utils * likelihoods;
 }
 
 float FirstPrice::GetRevenue(const Scatter& bids_in, int id) const {
@@ -98,4 +222,42 @@ float FirstPrice::GetValue(const Scatter& bids_in, int id) const {
   return Areas(integrate_vals, realized_value * likelihoods).sum();
 }
 
+Scatter FirstPrice::BestResponse(int id, int n_values, int n_bids) const {
+  const ArrayXd& value_xs = value_pdfs_[id].xs;
+  ArrayXd values =
+      ArrayXd::LinSpaced(n_values, value_xs(0), value_xs(value_xs.size() - 1));
+  ArrayXd bids = ArrayXd::LinSpaced(n_bids, 0, max_bid_);
+  ArrayXd win_probs = ArrayXd::Ones(n_bids);
+  for (int j = 0; j < n_players_; ++j) {
+    if (j != id) {
+      win_probs *= Interpolate(bid_cdfs_[j], bids);
+    }
+  }
+  // Rows are values and columns bids.
+  ArrayXXd profits = values.replicate(1, n_bids) -
+                     bids.transpose().replicate(n_values, 1);
+  ArrayXXd utils =
+      ExpectedUtility(utility_funcs_[id], prob_weight_funcs_[id], profits,
+                      win_probs.transpose().replicate(n_values, 1));
+  return {values, BestBids(utils, bids)};
+}
+
+FirstPrice FirstPrice::Mix(const std::vector<FirstPrice*>& envs) {
+  assert(!envs.empty());
+  FirstPrice mixed = *envs[0];
+  for (int j = 0; j < mixed.n_players_; ++j) {
+    std::vector<const Scatter*> cdfs;
+    for (auto env : envs) {
+      cdfs.push_back(&env->bid_cdfs_[j]);
+    }
+    mixed.bid_cdfs_[j] = MixtureCDF(cdfs, mixed.n_internal_samples_);
+    // The mixture is only kept on the sampled grid.
+    mixed.exact_bid_cdfs_[j] = PiecewiseLinear();
+    if (mixed.single_precision_) {
+      mixed.UpdateSingle(j);
+    }
+  }
+  return mixed;
+}
+
 }  // namespace auctions
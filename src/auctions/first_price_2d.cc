@@ -20,8 +20,7 @@ namespace auctions {
 
 void FirstPrice2D::Initialize(const std::vector<Distribution>& valuex_dists,
                               const std::vector<Distribution>& valuey_dists) {
-  prob_weight_funcs_ = std::vector<std::function<double(double)>>(
-      n_players_, [](double prob) { return prob; });
+  prob_weight_funcs_ = std::vector<ValueTransform>(n_players_);
   for (int i = 0; i < n_players_; ++i) {
     auto distx = valuex_dists[i];
     auto disty = valuey_dists[i];
@@ -29,10 +28,8 @@ void FirstPrice2D::Initialize(const std::vector<Distribution>& valuex_dists,
         ArrayXd::LinSpaced(n_internal_samples_, lower(distx), upper(distx));
     ArrayXd valuesy =
         ArrayXd::LinSpaced(n_internal_samples_, lower(disty), upper(disty));
-    ArrayXd xpdfs = valuesx.unaryExpr(
-        [&distx](double x) -> double { return pdf(distx, x); });
-    ArrayXd ypdfs = valuesy.unaryExpr(
-        [&disty](double y) -> double { return pdf(disty, y); });
+    ArrayXd xpdfs = pdf(distx, valuesx);
+    ArrayXd ypdfs = pdf(disty, valuesy);
     value_pdfs_.push_back(
         {valuesx, valuesy, JointPDFIndependent(xpdfs, ypdfs)});
   }
@@ -42,15 +39,11 @@ FirstPrice2D::FirstPrice2D(const std::vector<Distribution>& valuex_dists,
                            const std::vector<Distribution>& valuey_dists,
                            int n_internal_samples)
     : bid_cdfs_(valuex_dists.size()),
-      n_players_(valuex_dists.size()),
+      utility_funcs_(valuex_dists.size()),
       bid_margx_cdfs_(valuex_dists.size()),
       bid_margy_cdfs_(valuex_dists.size()),
+      n_players_(valuex_dists.size()),
       n_internal_samples_(n_internal_samples) {
-  std::function<double(double, double)> util = [](double x, double y) {
-    return x + y;
-  };
-  utility_funcs_ =
-      std::vector<std::function<double(double, double)>>(n_players_, util);
   Initialize(valuex_dists, valuey_dists);
 }
 
@@ -60,14 +53,27 @@ FirstPrice2D::FirstPrice2D(
     std::vector<std::function<double(double, double)>> utils,
     int n_internal_samples)
     : bid_cdfs_(valuex_dists.size()),
-      n_players_(valuex_dists.size()),
+      utility_funcs_(std::move(utils)),
       bid_margx_cdfs_(valuex_dists.size()),
       bid_margy_cdfs_(valuex_dists.size()),
-      n_internal_samples_(n_internal_samples),
-      utility_funcs_(utils) {
+      n_players_(valuex_dists.size()),
+      n_internal_samples_(n_internal_samples) {
   Initialize(valuex_dists, valuey_dists);
 }
 
+// An empty utility function means the two values are additive.
+ArrayXXd FirstPrice2D::BundleValue(int id, const ArrayXXd& valsx,
+                                   const ArrayXXd& valsy) const {
+  if (!utility_funcs_[id]) {
+    return valsx + valsy;
+  }
+  return valsx.binaryExpr(valsy, utility_funcs_[id]);
+}
+
+double FirstPrice2D::BundleValue(int id, double valx, double valy) const {
+  return utility_funcs_[id] ? utility_funcs_[id](valx, valy) : valx + valy;
+}
+
 void FirstPrice2D::AcceptStrategy(const GridMulti& bids, int id) {
   ArrayXd bidx_range =
       ArrayXd::LinSpaced(n_internal_samples_, bids.z_sets[0].minCoeff(),
@@ -122,14 +128,13 @@ float FirstPrice2D::GetFitness(const GridMulti& bids_in, int id) const {
   ArrayXXd zeros = ArrayXXd::Zero(bidsx.rows(), bidsx.cols());
   ArrayXXd win_none_probs = 1 - win_both_probs - win_x_probs - win_y_probs;
   ArrayXXd utils =
-      (valx_mesh.binaryExpr(valy_mesh, utility_funcs_[id]) - bidsx - bidsy) *
-          win_both_probs.unaryExpr(prob_weight_funcs_[id]) +
-      (valx_mesh.binaryExpr(zeros, utility_funcs_[id]) - bidsx) *
-          win_x_probs.unaryExpr(prob_weight_funcs_[id]) +
-      (zeros.binaryExpr(valy_mesh, utility_funcs_[id]) - bidsy) *
-          win_y_probs.unaryExpr(prob_weight_funcs_[id]) +
-      utility_funcs_[id](0, 0) *
-          (win_none_probs).unaryExpr(prob_weight_funcs_[id]);
+      (BundleValue(id, valx_mesh, valy_mesh) - bidsx - bidsy) *
+          prob_weight_funcs_[id](win_both_probs) +
+      (BundleValue(id, valx_mesh, zeros) - bidsx) *
+          prob_weight_funcs_[id](win_x_probs) +
+      (BundleValue(id, zeros, valy_mesh) - bidsy) *
+          prob_weight_funcs_[id](win_y_probs) +
+      BundleValue(id, 0, 0) * prob_weight_funcs_[id](win_none_probs);
   ArrayXXd likelihoods =
       Interpolate2D(value_pdfs_[id], integrate_valsx, integrate_valsy);
   return Areas2D(integrate_valsx, integrate_valsy, utils * likelihoods).sum();
@@ -170,10 +175,10 @@ float FirstPrice2D::GetExpectedRevenue(const GridMulti& bids_in, int id) const {
   ArrayXXd zeros = ArrayXXd::Zero(bidsx.rows(), bidsx.cols());
   ArrayXXd win_none_probs = 1 - win_both_probs - win_x_probs - win_y_probs;
   ArrayXXd utils =
-      (bidsx + bidsy) * win_both_probs.unaryExpr(prob_weight_funcs_[id]) +
-      (bidsx)*win_x_probs.unaryExpr(prob_weight_funcs_[id]) +
-      (bidsy)*win_y_probs.unaryExpr(prob_weight_funcs_[id]) +
-      0 * (win_none_probs).unaryExpr(prob_weight_funcs_[id]);
+      (bidsx + bidsy) * prob_weight_funcs_[id](win_both_probs) +
+      (bidsx)*prob_weight_funcs_[id](win_x_probs) +
+      (bidsy)*prob_weight_funcs_[id](win_y_probs) +
+      0 * prob_weight_funcs_[id](win_none_probs);
   ArrayXXd likelihoods =
       Interpolate2D(value_pdfs_[id], integrate_valsx, integrate_valsy);
   return Areas2D(integrate_valsx, integrate_valsy, utils * likelihoods).sum();
@@ -213,14 +218,12 @@ float FirstPrice2D::GetExpectedValue(const GridMulti& bids_in, int id) const {
   win_y_probs -= win_both_probs;
   ArrayXXd zeros = ArrayXXd::Zero(bidsx.rows(), bidsx.cols());
   ArrayXXd win_none_probs = 1 - win_both_probs - win_x_probs - win_y_probs;
-  ArrayXXd utils = (valx_mesh.binaryExpr(valy_mesh, utility_funcs_[id])) *
-                       win_both_probs.unaryExpr(prob_weight_funcs_[id]) +
-                   (valx_mesh.binaryExpr(zeros, utility_funcs_[id])) *
-                       win_x_probs.unaryExpr(prob_weight_funcs_[id]) +
-                   (zeros.binaryExpr(valy_mesh, utility_funcs_[id])) *
-                       win_y_probs.unaryExpr(prob_weight_funcs_[id]) +
-                   utility_funcs_[id](0, 0) *
-                       (win_none_probs).unaryExpr(prob_weight_funcs_[id]);
+  ArrayXXd utils =
+      BundleValue(id, valx_mesh, valy_mesh) *
+          prob_weight_funcs_[id](win_both_probs) +
+      BundleValue(id, valx_mesh, zeros) * prob_weight_funcs_[id](win_x_probs) +
+      BundleValue(id, zeros, valy_mesh) * prob_weight_funcs_[id](win_y_probs) +
+      BundleValue(id, 0, 0) * prob_weight_funcs_[id](win_none_probs);
   ArrayXXd likelihoods =
       Interpolate2D(value_pdfs_[id], integrate_valsx, integrate_valsy);
   return Areas2D(integrate_valsx, integrate_valsy, utils * likelihoods).sum();
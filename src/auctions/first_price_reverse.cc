@@ -22,15 +22,12 @@ FirstPriceReverse::FirstPriceReverse(
     : bid_cdfs_(cost_dists.size()),
       n_players_(cost_dists.size()),
       n_internal_samples_(n_internal_samples) {
-  utility_funcs_ = std::vector<std::function<double(double)>>(
-      n_players_, [](double val) { return val; });
-  prob_weight_funcs_ = std::vector<std::function<double(double)>>(
-      n_players_, [](double prob) { return prob; });
+  utility_funcs_ = std::vector<ValueTransform>(n_players_);
+  prob_weight_funcs_ = std::vector<ValueTransform>(n_players_);
   for (const auto& dist : cost_dists) {
     ArrayXd values =
         ArrayXd::LinSpaced(n_internal_samples, lower(dist), upper(dist));
-    ArrayXd pdfs =
-        values.unaryExpr([&dist](double x) -> double { return pdf(dist, x); });
+    ArrayXd pdfs = pdf(dist, values);
     cost_pdfs_.push_back({values, pdfs});
   }
 }
@@ -56,9 +53,8 @@ float FirstPriceReverse::GetFitness(const Scatter& bids_in, int id) const {
     }
   }
   ArrayXd utils =
-      profits.unaryExpr(utility_funcs_[id]) *
-          win_probs.unaryExpr(prob_weight_funcs_[id]) +
-      utility_funcs_[id](0) * (1 - win_probs).unaryExpr(prob_weight_funcs_[id]);
+      ExpectedUtility(utility_funcs_[id], prob_weight_funcs_[id], profits,
+                      win_probs);
   ArrayXd likelihoods = Interpolate(cost_pdfs_[id], integrate_costs);
   return Areas(integrate_costs, utils * likelihoods).sum();
 }
@@ -3,9 +3,11 @@
 #include <algorithm>
 #include <iostream>
 
+#include "auctions/best_response.h"
 #include "numericaldists/distribution_ops.h"
 #include "numericaldists/function_ops.h"
 #include "numericaldists/order_statistic_ops.h"
+#include "numericaldists/quadrature.h"
 
 using namespace numericaldists;
 using namespace Eigen;
@@ -20,15 +22,12 @@ SecondPrice::SecondPrice(std::vector<Distribution> value_dists,
       n_players_(value_dists.size()),
       n_internal_samples_(n_internal_samples),
       pre_calculated_(false) {
-  utility_funcs_ = std::vector<std::function<double(double)>>(
-      n_players_, [](double val) { return val; });
-  prob_weight_funcs_ = std::vector<std::function<double(double)>>(
-      n_players_, [](double prob) { return prob; });
+  utility_funcs_ = std::vector<ValueTransform>(n_players_);
+  prob_weight_funcs_ = std::vector<ValueTransform>(n_players_);
   internal_values_ = ArrayXd::LinSpaced(n_internal_samples, lower(value_dists),
                                         upper(value_dists));
   for (const auto& dist : value_dists) {
-    ArrayXd pdfs = internal_values_.unaryExpr(
-        [&dist](double x) -> double { return pdf(dist, x); });
+    ArrayXd pdfs = pdf(dist, internal_values_);
     value_pdfs_.push_back(pdfs);
   }
   internal_bids_ =
@@ -47,9 +46,23 @@ float SecondPrice::GetFitness(const Scatter& bids_in, int id) const {
     Precalculate();
   }
 
+  double low = bids_in.xs(0);
+  double high = bids_in.xs(bids_in.xs.size() - 1);
+  if (integration_tolerance_ > 0) {
+    auto integrand = [&](const ArrayXd& vals) {
+      return FitnessIntegrand(bids_in, id, vals);
+    };
+    return IntegrateAdaptive(integrand, low, high, integration_tolerance_)
+        .value;
+  }
   ArrayXd integrate_vals =
-      ArrayXd::LinSpaced((bids_in.xs.size() - 1) * 3, bids_in.xs(0),
-                         bids_in.xs(bids_in.xs.size() - 1));
+      ArrayXd::LinSpaced((bids_in.xs.size() - 1) * 3, low, high);
+  return Areas(integrate_vals, FitnessIntegrand(bids_in, id, integrate_vals))
+      .sum();
+}
+
+ArrayXd SecondPrice::FitnessIntegrand(const Scatter& bids_in, int id,
+                                     const ArrayXd& integrate_vals) const {
   ArrayXd bids = Interpolate(bids_in, integrate_vals);
   ArrayXd win_probs =
       Interpolate(internal_bids_, other_highest_cdfs_[id], bids);
@@ -57,12 +70,11 @@ float SecondPrice::GetFitness(const Scatter& bids_in, int id) const {
       Interpolate(internal_bids_, exp_value_funcs_[id], bids);
   ArrayXd profits = integrate_vals - exp_second_bid_given_win;
   ArrayXd utils =
-      profits.unaryExpr(utility_funcs_[id]) *
-          win_probs.unaryExpr(prob_weight_funcs_[id]) +
-      utility_funcs_[id](0) * (1 - win_probs).unaryExpr(prob_weight_funcs_[id]);
+      ExpectedUtility(utility_funcs_[id], prob_weight_funcs_[id], profits,
+                      win_probs);
   ArrayXd likelihoods =
       Interpolate(internal_values_, value_pdfs_[id], integrate_vals);
-  return Areas(integrate_vals, utils * likelihoods).sum();
+  return utils * likelihoods;
 }
 
 float SecondPrice::GetRevenue(const Scatter& bids_in, int id) const {
@@ -102,8 +114,34 @@ float SecondPrice::GetValue(const Scatter& bids_in, int id) const {
   return Areas(integrate_vals, realized_value * likelihoods).sum();
 }
 
+Scatter SecondPrice::BestResponse(int id, int n_values, int n_bids) const {
+  if (!pre_calculated_) {
+    Precalculate();
+  }
+
+  ArrayXd values =
+      ArrayXd::LinSpaced(n_values, internal_values_(0),
+                         internal_values_(internal_values_.size() - 1));
+  ArrayXd bids = ArrayXd::LinSpaced(
+      n_bids, internal_bids_(0), internal_bids_(internal_bids_.size() - 1));
+  ArrayXd win_probs =
+      Interpolate(internal_bids_, other_highest_cdfs_[id], bids);
+  ArrayXd exp_second_bid_given_win =
+      Interpolate(internal_bids_, exp_value_funcs_[id], bids);
+  // Rows are values and columns bids.
+  ArrayXXd profits =
+      values.replicate(1, n_bids) -
+      exp_second_bid_given_win.transpose().replicate(n_values, 1);
+  ArrayXXd utils =
+      ExpectedUtility(utility_funcs_[id], prob_weight_funcs_[id], profits,
+                      win_probs.transpose().replicate(n_values, 1));
+  return {values, BestBids(utils, bids)};
+}
 
 void SecondPrice::Precalculate() const {
+  if (pre_calculated_) {
+    return;
+  }
   for (int i = 0; i < n_players_; ++i) {
     std::vector<ArrayXd> other_cdfs;
     for (int j = 0; j < n_players_; ++j) {
@@ -0,0 +1,118 @@
+#include "auctions/signal_value_dist.h"
+
+#include <cassert>
+#include <exception>
+#include <future>
+#include <iterator>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <tuple>
+#include <vector>
+
+#include "genericga/checkpoint.h"
+#include "numericaldists/distribution_ops.h"
+#include "numericaldists/order_statistic_ops.h"
+
+using namespace numericaldists;
+using namespace Eigen;
+
+namespace auctions {
+
+ArrayXXd MidpointSpreadPDF(int n_draws, float epsilon, int n_samples) {
+  assert(n_draws > 1);
+  ArrayXd signals = ArrayXd::LinSpaced(n_samples, -epsilon, epsilon);
+  ArrayXd mstars = ArrayXd::LinSpaced(n_samples, -epsilon, epsilon);
+  ArrayXd precs = ArrayXd::LinSpaced(n_samples, 0, 2 * epsilon);
+  ArrayXd signal_cdf = ArrayXd::LinSpaced(n_samples, 0, 1);
+  ArrayXXd signal_x_mesh = GetXMesh(signals, signals.size());
+  ArrayXXd signal_y_mesh = GetYMesh(signals, signals.size());
+  ArrayXXd mstar_mesh = (signal_x_mesh + signal_y_mesh) / 2;
+  ArrayXXd prec_mesh = (signal_y_mesh - signal_x_mesh).abs();
+  ArrayXXd joint =
+      LowestHighestJointOrderStatisticPDF(signals, signal_cdf, n_draws);
+  ArrayXXd joint_m_r_cdf = TwoRandomVariableFunctionCDF(
+      signals, signals, joint, mstar_mesh, prec_mesh, mstars, precs);
+  return PDF2D(mstars, precs, joint_m_r_cdf);
+}
+
+std::shared_ptr<const ArrayXXd> SharedMidpointSpreadPDF(int n_draws,
+                                                        float epsilon,
+                                                        int n_samples) {
+  using Table = std::shared_ptr<const ArrayXXd>;
+  using Key = std::tuple<int, float, int>;
+  static std::mutex mutex;
+  // Tables in use, and tables still being built, by their arguments.
+  static std::map<Key, std::weak_ptr<const ArrayXXd>> tables;
+  static std::map<Key, std::shared_future<Table>> building;
+  Key key = std::make_tuple(n_draws, epsilon, n_samples);
+  std::promise<Table> promise;
+  std::shared_future<Table> pending;
+  {
+    std::lock_guard<std::mutex> lock(mutex);
+    auto it = tables.find(key);
+    if (it != tables.end()) {
+      if (Table table = it->second.lock()) {
+        return table;
+      }
+    }
+    auto build = building.find(key);
+    if (build != building.end()) {
+      pending = build->second;
+    } else {
+      building.emplace(key, promise.get_future().share());
+    }
+  }
+  if (pending.valid()) {
+    return pending.get();
+  }
+  // Built outside the lock so tables for other arguments are not held up.
+  // If the build fails, waiting callers get the same exception and later
+  // ones try again.
+  Table table;
+  try {
+    table = std::make_shared<const ArrayXXd>(
+        MidpointSpreadPDF(n_draws, epsilon, n_samples));
+  } catch (...) {
+    {
+      std::lock_guard<std::mutex> lock(mutex);
+      building.erase(key);
+    }
+    promise.set_exception(std::current_exception());
+    throw;
+  }
+  {
+    std::lock_guard<std::mutex> lock(mutex);
+    // Drop the entries of tables nobody holds any more.
+    for (auto it = tables.begin(); it != tables.end();) {
+      it = it->second.expired() ? tables.erase(it) : std::next(it);
+    }
+    tables[key] = table;
+    building.erase(key);
+  }
+  promise.set_value(table);
+  return table;
+}
+
+void CheckLoadedStrategies(
+    const std::vector<numericaldists::Scatter>& rel_bid_funcs,
+    const std::vector<float>& one_draw_rel_bids, const Eigen::ArrayXd& precs) {
+  if (one_draw_rel_bids.size() != rel_bid_funcs.size()) {
+    throw genericga::CheckpointError("checkpoint has the wrong player count");
+  }
+  double low = precs(0);
+  double high = precs(precs.size() - 1);
+  double slack = 1e-6 * (high - low);
+  for (const auto& func : rel_bid_funcs) {
+    if (func.xs.size() != func.ys.size() || func.xs.size() == 1) {
+      throw genericga::CheckpointError("checkpoint bid function is malformed");
+    }
+    if (func.xs.size() > 0 && (func.xs.minCoeff() < low - slack ||
+                               func.xs.maxCoeff() > high + slack)) {
+      throw genericga::CheckpointError(
+          "checkpoint bid function is off the auction's grid");
+    }
+  }
+}
+
+}  // namespace auctions
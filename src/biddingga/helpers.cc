@@ -1,25 +1,61 @@
 #include "biddingga/helpers.h"
+
+#include <charconv>
+#include <climits>
+#include <cstdint>
+#include <cstdlib>
+#include <cstring>
+#include <iostream>
+#include <string>
+#include <random>
 #include <vector>
 
+#include "genericga/random.h"
+
 namespace biddingga {
 
-std::vector<unsigned char> RandomByteArray(int n_bytes) {
-  static auto generator = std::mt19937(std::random_device()());
+std::vector<unsigned char> RandomByteArray(int n_bytes,
+                                           genericga::Philox4x32& gen) {
   std::uniform_int_distribution<int> dist(0, UCHAR_MAX);
   std::vector<unsigned char> rand_gene(n_bytes);
   for (int j = 0; j < n_bytes; ++j) {
-    rand_gene[j] = static_cast<unsigned char>(dist(generator));
+    rand_gene[j] = static_cast<unsigned char>(dist(gen));
   }
   return rand_gene;
 }
 
 std::vector<genericga::binary::ByteArrayGenotype> RandomGenes(int pop_size,
                                                               int n_bytes) {
+  auto stream = genericga::MakeStream();
   std::vector<genericga::binary::ByteArrayGenotype> genes;
   for (int i = 0; i < pop_size; ++i) {
-    genes.emplace_back(RandomByteArray(n_bytes));
+    auto gen = stream.Substream(0, i);
+    genes.emplace_back(RandomByteArray(n_bytes, gen));
   }
   return genes;
 }
 
+std::uint64_t SeedFromArgs(int* argc, char** argv) {
+  int kept = 1;
+  for (int i = 1; i < *argc; ++i) {
+    if (std::strncmp(argv[i], "seed=", 5) == 0) {
+      const char* first = argv[i] + 5;
+      const char* last = first + std::strlen(first);
+      std::uint64_t seed;
+      auto [end, error] = std::from_chars(first, last, seed);
+      if (error != std::errc() || end != last) {
+        std::cerr << "Invalid " << argv[i]
+                  << ": the seed must be a non-negative 64-bit integer"
+                  << std::endl;
+        std::exit(EXIT_FAILURE);
+      }
+      genericga::SetRunSeed(seed);
+    } else {
+      argv[kept++] = argv[i];
+    }
+  }
+  *argc = kept;
+  return genericga::GetRunSeed();
+}
+
 }  // namespace biddingga
@@ -0,0 +1,219 @@
+#include "biddingga/results.h"
+
+#include <cassert>
+#include <cstdint>
+#include <cstring>
+#include <filesystem>
+#include <fstream>
+#include <istream>
+#include <mutex>
+#include <ostream>
+#include <string>
+#include <system_error>
+#include <utility>
+#include <vector>
+
+#include <eigen3/Eigen/Core>
+
+namespace biddingga {
+
+namespace {
+
+constexpr char kMagic[] = "BGARES02";
+constexpr char kUnseededMagic[] = "BGARES01";
+constexpr int kMagicSize = sizeof(kMagic) - 1;
+constexpr int kBufferSize = 1 << 20;
+
+void WriteInt(std::ostream& os, std::int32_t val) {
+  os.write(reinterpret_cast<const char*>(&val), sizeof(val));
+}
+
+bool ReadInt(std::istream& is, std::int32_t* val) {
+  return static_cast<bool>(
+      is.read(reinterpret_cast<char*>(val), sizeof(*val)));
+}
+
+}  // namespace
+
+void ResultsSnapshot::Add(std::string name, const Eigen::ArrayXd& values) {
+  std::vector<float> column(values.size());
+  Eigen::Map<Eigen::ArrayXf>(column.data(), column.size()) =
+      values.cast<float>();
+  Add(std::move(name), std::move(column));
+}
+
+void ResultsSnapshot::Add(std::string name, std::vector<float> values) {
+  names.push_back(std::move(name));
+  columns.push_back(std::move(values));
+}
+
+void WriteResultsHeader(std::ostream& os, std::uint64_t seed) {
+  os.write(kMagic, kMagicSize);
+  os.write(reinterpret_cast<const char*>(&seed), sizeof(seed));
+}
+
+void WriteSnapshot(std::ostream& os, const ResultsSnapshot& snapshot) {
+  assert(snapshot.names.size() == snapshot.columns.size());
+  WriteInt(os, snapshot.round);
+  WriteInt(os, snapshot.columns.size());
+  for (int i = 0; i < static_cast<int>(snapshot.columns.size()); ++i) {
+    const auto& name = snapshot.names[i];
+    const auto& column = snapshot.columns[i];
+    WriteInt(os, name.size());
+    os.write(name.data(), name.size());
+    WriteInt(os, column.size());
+    os.write(reinterpret_cast<const char*>(column.data()),
+             column.size() * sizeof(float));
+  }
+}
+
+bool ReadResultsHeader(std::istream& is, std::uint64_t* seed) {
+  char magic[kMagicSize];
+  if (!is.read(magic, kMagicSize)) {
+    return false;
+  }
+  std::uint64_t file_seed = 0;
+  if (std::memcmp(magic, kMagic, kMagicSize) == 0) {
+    if (!is.read(reinterpret_cast<char*>(&file_seed), sizeof(file_seed))) {
+      return false;
+    }
+  } else if (std::memcmp(magic, kUnseededMagic, kMagicSize) != 0) {
+    return false;
+  }
+  if (seed != nullptr) {
+    *seed = file_seed;
+  }
+  return true;
+}
+
+bool ReadSnapshot(std::istream& is, ResultsSnapshot* snapshot) {
+  std::int32_t round;
+  std::int32_t n_columns;
+  if (!ReadInt(is, &round) || !ReadInt(is, &n_columns) || n_columns < 0) {
+    return false;
+  }
+  snapshot->round = round;
+  snapshot->names.resize(n_columns);
+  snapshot->columns.resize(n_columns);
+  for (int i = 0; i < n_columns; ++i) {
+    std::int32_t size;
+    if (!ReadInt(is, &size) || size < 0) {
+      return false;
+    }
+    snapshot->names[i].resize(size);
+    if (!is.read(&snapshot->names[i][0], size) || !ReadInt(is, &size) ||
+        size < 0) {
+      return false;
+    }
+    snapshot->columns[i].resize(size);
+    if (!is.read(reinterpret_cast<char*>(snapshot->columns[i].data()),
+                 size * sizeof(float))) {
+      return false;
+    }
+  }
+  return true;
+}
+
+void WriteSnapshotCSV(std::ostream& os, const ResultsSnapshot& snapshot) {
+  for (const auto& column : snapshot.columns) {
+    for (int i = 0; i < static_cast<int>(column.size()); ++i) {
+      if (i != 0) {
+        os << ',';
+      }
+      os << column[i];
+    }
+    os << '\n';
+  }
+}
+
+ResultsWriter::ResultsWriter(const std::string& path, int snapshot_frequency,
+                             std::uint64_t seed)
+    : snapshot_frequency_(snapshot_frequency), buffer_(kBufferSize) {
+  open_ = Open(path, false, seed);
+  thread_ = std::thread(&ResultsWriter::Run, this);
+}
+
+ResultsWriter::ResultsWriter(const std::string& path, int snapshot_frequency,
+                             int resume_round, std::uint64_t seed)
+    : snapshot_frequency_(snapshot_frequency), buffer_(kBufferSize) {
+  std::streamoff keep = 0;
+  {
+    std::ifstream in(path, std::ifstream::binary);
+    if (ReadResultsHeader(in)) {
+      keep = in.tellg();
+      ResultsSnapshot snapshot;
+      while (ReadSnapshot(in, &snapshot) && snapshot.round <= resume_round) {
+        keep = in.tellg();
+      }
+    }
+  }
+  // Appending after snapshots that could not be dropped would leave rounds
+  // out of order, so a failed resize fails the writer.
+  std::error_code error;
+  if (keep > 0) {
+    std::filesystem::resize_file(path, keep, error);
+  }
+  open_ = !error && Open(path, keep > 0, seed);
+  thread_ = std::thread(&ResultsWriter::Run, this);
+}
+
+bool ResultsWriter::Open(const std::string& path, bool append,
+                         std::uint64_t seed) {
+  assert(snapshot_frequency_ > 0);
+  // The buffer has to be installed before the file is opened to take effect.
+  out_.rdbuf()->pubsetbuf(buffer_.data(), buffer_.size());
+  if (append) {
+    out_.open(path, std::ofstream::binary | std::ofstream::app);
+  } else {
+    out_.open(path, std::ofstream::binary);
+    if (out_) {
+      WriteResultsHeader(out_, seed);
+    }
+  }
+  return static_cast<bool>(out_);
+}
+
+ResultsWriter::~ResultsWriter() {
+  {
+    std::lock_guard<std::mutex> lock(mutex_);
+    done_ = true;
+  }
+  queued_.notify_one();
+  thread_.join();
+  out_.flush();
+}
+
+void ResultsWriter::Write(ResultsSnapshot snapshot) {
+  {
+    std::lock_guard<std::mutex> lock(mutex_);
+    queue_.push_back(std::move(snapshot));
+  }
+  queued_.notify_one();
+}
+
+bool ResultsWriter::Flush() {
+  std::unique_lock<std::mutex> lock(mutex_);
+  written_.wait(lock, [this] { return queue_.empty() && !writing_; });
+  out_.flush();
+  return open_ && out_;
+}
+
+void ResultsWriter::Run() {
+  std::unique_lock<std::mutex> lock(mutex_);
+  while (true) {
+    queued_.wait(lock, [this] { return done_ || !queue_.empty(); });
+    if (queue_.empty()) {
+      return;
+    }
+    ResultsSnapshot snapshot = std::move(queue_.front());
+    queue_.pop_front();
+    writing_ = true;
+    lock.unlock();
+    WriteSnapshot(out_, snapshot);
+    lock.lock();
+    writing_ = false;
+    written_.notify_all();
+  }
+}
+
+}  // namespace biddingga
@@ -1,25 +1,64 @@
 #include "genericga/binary/bit_mutator.h"
 
+#include <cmath>
+#include <limits>
 #include <random>
+#include <vector>
 
 namespace genericga {
 namespace binary {
 
-BitMutator::BitMutator(float exp_bit_muts)
-    : BitMutator(exp_bit_muts, std::random_device()()) {}
+BitMutator::BitMutator(float exp_bit_muts, bool geometric_skip)
+    : exp_bit_muts_(exp_bit_muts), geometric_skip_(geometric_skip) {}
 
-BitMutator::BitMutator(float exp_bit_muts, int seed)
-    : gen_(seed), muts_dist_(exp_bit_muts), bit_dist_(0, 0) {}
+void BitMutator::operator()(ByteArrayGenotype& gene, Philox4x32& gen) const {
+  std::poisson_distribution<> muts_dist(exp_bit_muts_);
+  std::uniform_int_distribution<> bit_dist(0, gene.NBits() - 1);
+  int n_muts = muts_dist(gen);
+  for (int i = 0; i < n_muts; ++i) {
+    gene.Flip(bit_dist(gen));
+  }
+}
 
-void BitMutator::operator()(ByteArrayGenotype& gene) {
-  if (gene.NBits() != n_bits_) {
-    n_bits_ = gene.NBits();
-    bit_dist_ = std::uniform_int_distribution<>(0, n_bits_ - 1);
+void BitMutator::MutateAll(std::vector<ByteArrayGenotype>& genes,
+                           const Philox4x32& stream, int generation) const {
+  if (!geometric_skip_) {
+    Mutator<ByteArrayGenotype>::MutateAll(genes, stream, generation);
+    return;
+  }
+  long total_bits = 0;
+  for (const auto& gene : genes) {
+    total_bits += gene.NBits();
   }
+  if (total_bits == 0) {
+    return;
+  }
+  auto gen = stream.Substream(generation, 0);
+  GeometricSkipFlip(genes, exp_bit_muts_ * genes.size() / total_bits, gen);
+}
 
-  int n_muts = muts_dist_(gen_);
-  for (int i = 0; i < n_muts; ++i) {
-    gene.Flip(bit_dist_(gen_));
+void GeometricSkipFlip(std::vector<ByteArrayGenotype>& genes, double bit_rate,
+                       Philox4x32& gen) {
+  if (bit_rate <= 0) {
+    return;
+  }
+  // The gap before the next flip is Geometric(bit_rate), drawn by inversion as
+  // floor(log(u) / log(1 - bit_rate)) with u uniform on (0, 1].
+  double inv_log_miss = bit_rate < 1 ? 1.0 / std::log1p(-bit_rate) : 0;
+  auto next_gap = [&gen, inv_log_miss]() {
+    double u = (gen() + 1.0) * (1.0 / 4294967296.0);
+    double gap = std::floor(std::log(u) * inv_log_miss);
+    return gap < std::numeric_limits<long>::max() / 2
+               ? static_cast<long>(gap)
+               : std::numeric_limits<long>::max() / 2;
+  };
+  long pos = next_gap();
+  for (auto& gene : genes) {
+    while (pos < gene.NBits()) {
+      gene.Flip(static_cast<int>(pos));
+      pos += 1 + next_gap();
+    }
+    pos -= gene.NBits();
   }
 }
 
@@ -3,10 +3,15 @@
 #include <boost/functional/hash.hpp>
 #include <eigen3/Eigen/Core>
 
+#include <algorithm>
 #include <cassert>
+#include <cmath>
+#include <istream>
+#include <ostream>
 
 #include "genericga/binary/float_encoding.h"
 #include "genericga/binary/int_encoding.h"
+#include "genericga/checkpoint.h"
 
 namespace genericga {
 namespace binary {
@@ -68,6 +73,38 @@ Eigen::ArrayXf ByteArrayGenotype::ToEigenFloatArray(
   return ret;
 }
 
+void ByteArrayGenotype::SetFloatArray(
+    const std::vector<float>& values,
+    const std::vector<FloatEncoding>& encodings) {
+  assert(values.size() == encodings.size());
+  int bit = 0;
+  for (int i = 0; i < values.size(); ++i) {
+    const auto& encoding = encodings[i];
+    // 2^32 codes do not fit in an unsigned int, so scale in doubles.
+    double n_codes = std::pow(2.0, encoding.bit_precision);
+    double code = std::round((values[i] - encoding.min) /
+                             (encoding.max - encoding.min) * n_codes);
+    unsigned int int_conversion =
+        static_cast<unsigned int>(std::clamp(code, 0.0, n_codes - 1));
+    if (encoding.is_gray_coded) {
+      int_conversion = BinaryToGray(int_conversion);
+    }
+    SetBits(bit, encoding.bit_precision, int_conversion);
+    bit += encoding.bit_precision;
+  }
+}
+
+void ByteArrayGenotype::SetBits(int start_bit, int n_bits,
+                                unsigned int value) {
+  assert(n_bits <= (sizeof(int) * CHAR_BIT));
+  for (int i = 0; i < n_bits; ++i) {
+    unsigned int bit = (value >> (n_bits - 1 - i)) & 1u;
+    if (FromBits(start_bit + i, 1) != bit) {
+      Flip(start_bit + i);
+    }
+  }
+}
+
 unsigned int ByteArrayGenotype::FromBits(int start_bit, int n_bits) const {
   assert(n_bits <= (sizeof(int) * CHAR_BIT));
   assert(n_bits >= 0);
@@ -163,6 +200,8 @@ unsigned char FromSubByte(unsigned char byte, int start_bit, int n_bits) {
          (CHAR_BIT - n_bits - start_bit);
 }
 
+unsigned int BinaryToGray(unsigned int num) { return num ^ (num >> 1); }
+
 // From Wikipedia:
 // A more efficient version for Gray codes 32 bits or fewer through the use of
 // SWAR (SIMD within a register) techniques. It implements a parallel prefix
@@ -210,5 +249,13 @@ std::size_t hash_value(const ByteArrayGenotype& s) {
   return hasher(s.data_);
 }
 
+void WriteBinary(std::ostream& os, const ByteArrayGenotype& gene) {
+  genericga::WriteBinary(os, gene.data_);
+}
+
+void ReadBinary(std::istream& is, ByteArrayGenotype* gene) {
+  genericga::ReadBinary(is, &gene->data_);
+}
+
 }  // namespace binary
 }  // namespace genericga
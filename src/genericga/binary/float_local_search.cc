@@ -0,0 +1,57 @@
+#include "genericga/binary/float_local_search.h"
+
+#include <vector>
+
+namespace genericga {
+namespace binary {
+
+namespace {
+
+std::vector<double> Bounds(const std::vector<FloatEncoding>& encodings,
+                           bool upper) {
+  std::vector<double> bounds;
+  bounds.reserve(encodings.size());
+  for (const auto& encoding : encodings) {
+    bounds.push_back(upper ? encoding.max : encoding.min);
+  }
+  return bounds;
+}
+
+}  // namespace
+
+FloatLocalSearch::FloatLocalSearch(std::vector<FloatEncoding> encodings,
+                                   int n_iterations, double initial_step)
+    : encodings_(encodings),
+      search_(Bounds(encodings, false), Bounds(encodings, true), n_iterations,
+              initial_step) {}
+
+std::vector<ByteArrayGenotype> FloatLocalSearch::operator()(
+    const ByteArrayGenotype& start,
+    const GenotypeFitness<ByteArrayGenotype>& fitness) const {
+  std::vector<float> floats = start.ToFloatArray(encodings_);
+  std::vector<double> values(floats.begin(), floats.end());
+  auto value_fitness = [&](const std::vector<std::vector<double>>& points) {
+    std::vector<ByteArrayGenotype> genes;
+    genes.reserve(points.size());
+    for (const auto& point : points) {
+      genes.push_back(Encode(start, point));
+    }
+    return fitness(genes);
+  };
+  std::vector<ByteArrayGenotype> improved;
+  for (const auto& point : search_(values, value_fitness)) {
+    improved.push_back(Encode(start, point));
+  }
+  return improved;
+}
+
+ByteArrayGenotype FloatLocalSearch::Encode(
+    const ByteArrayGenotype& base, const std::vector<double>& values) const {
+  ByteArrayGenotype gene = base;
+  gene.SetFloatArray(std::vector<float>(values.begin(), values.end()),
+                     encodings_);
+  return gene;
+}
+
+}  // namespace binary
+}  // namespace genericga
@@ -1,23 +1,18 @@
 #include "genericga/binary/single_point_crossover.h"
 
+#include <algorithm>
 #include <random>
 
 namespace genericga {
 namespace binary {
 
-SinglePointCrossover::SinglePointCrossover()
-    : SinglePointCrossover(std::random_device()()) {}
-
-SinglePointCrossover::SinglePointCrossover(int seed) : gen_(seed), dist(0, 0) {}
-
 void SinglePointCrossover::operator()(ByteArrayGenotype& gene1,
-                                      ByteArrayGenotype& gene2) {
-  if (gene1.NBits() != n_bits_ || gene2.NBits() != n_bits_) {
-    n_bits_ = std::min(gene1.NBits(), gene2.NBits());
-    dist = std::uniform_int_distribution<>(0, n_bits_ - 1);
-  }
-  int bit1 = dist(gen_);
-  int bit2 = dist(gen_);
+                                      ByteArrayGenotype& gene2,
+                                      Philox4x32& gen) const {
+  int n_bits = std::min(gene1.NBits(), gene2.NBits());
+  std::uniform_int_distribution<> dist(0, n_bits - 1);
+  int bit1 = dist(gen);
+  int bit2 = dist(gen);
   CrossoverGenes(gene1, gene2, bit1, bit2);
 }
 
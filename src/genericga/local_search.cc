@@ -0,0 +1,79 @@
+#include "genericga/local_search.h"
+
+#include <algorithm>
+#include <cassert>
+#include <utility>
+#include <vector>
+
+namespace genericga {
+
+CoordinateSearch::CoordinateSearch(std::vector<double> mins,
+                                   std::vector<double> maxs, int n_iterations,
+                                   double initial_step)
+    : mins_(std::move(mins)),
+      maxs_(std::move(maxs)),
+      n_iterations_(n_iterations),
+      initial_step_(initial_step) {
+  assert(mins_.size() == maxs_.size());
+}
+
+std::vector<std::vector<double>> CoordinateSearch::operator()(
+    const std::vector<double>& start,
+    const GenotypeFitness<std::vector<double>>& fitness) const {
+  assert(start.size() == mins_.size());
+  int n_dims = start.size();
+  std::vector<double> steps(n_dims);
+  for (int i = 0; i < n_dims; ++i) {
+    steps[i] = initial_step_ * (maxs_[i] - mins_[i]);
+  }
+  std::vector<double> best = start;
+  float start_fit = fitness({start})[0];
+  float best_fit = start_fit;
+  for (int iter = 0; iter < n_iterations_; ++iter) {
+    // Candidate 2 * i moves coordinate i up and 2 * i + 1 moves it down.
+    std::vector<std::vector<double>> candidates(2 * n_dims, best);
+    for (int i = 0; i < n_dims; ++i) {
+      candidates[2 * i][i] = std::min(best[i] + steps[i], maxs_[i]);
+      candidates[2 * i + 1][i] = std::max(best[i] - steps[i], mins_[i]);
+    }
+    std::vector<float> fits = fitness(candidates);
+
+    std::vector<double> combined = best;
+    int n_improving = 0;
+    int best_ind = -1;
+    float iter_fit = best_fit;
+    for (int i = 0; i < n_dims; ++i) {
+      int better = fits[2 * i] >= fits[2 * i + 1] ? 2 * i : 2 * i + 1;
+      if (fits[better] > best_fit) {
+        combined[i] = candidates[better][i];
+        ++n_improving;
+      }
+      if (fits[better] > iter_fit) {
+        iter_fit = fits[better];
+        best_ind = better;
+      }
+    }
+    if (best_ind < 0) {
+      for (double& step : steps) {
+        step /= 2;
+      }
+      continue;
+    }
+    best = std::move(candidates[best_ind]);
+    best_fit = iter_fit;
+    // Separable problems gain from taking every improving step at once.
+    if (n_improving > 1) {
+      float combined_fit = fitness({combined})[0];
+      if (combined_fit > best_fit) {
+        best = std::move(combined);
+        best_fit = combined_fit;
+      }
+    }
+  }
+  if (best_fit > start_fit) {
+    return {best};
+  }
+  return {};
+}
+
+}  // namespace genericga
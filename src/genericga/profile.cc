@@ -0,0 +1,74 @@
+#include "genericga/profile.h"
+
+#include <ostream>
+#include <set>
+#include <string>
+
+namespace genericga {
+
+double ProfileLog::GetTime(int generation, const std::string& name) const {
+  const auto& times = generations_[generation].times;
+  auto it = times.find(name);
+  return it == times.end() ? 0 : it->second;
+}
+
+long ProfileLog::GetCount(int generation, const std::string& name) const {
+  const auto& counts = generations_[generation].counts;
+  auto it = counts.find(name);
+  return it == counts.end() ? 0 : it->second;
+}
+
+void ProfileLog::WriteCSV(std::ostream& os) const {
+  // Names can first appear in any generation, so collect every column first.
+  std::set<std::string> time_names;
+  std::set<std::string> count_names;
+  for (int g = 0; g < GetGenerationCount(); ++g) {
+    for (const auto& [name, seconds] : generations_[g].times) {
+      time_names.insert(name);
+    }
+    for (const auto& [name, count] : generations_[g].counts) {
+      count_names.insert(name);
+    }
+  }
+  os << "generation";
+  for (const auto& name : time_names) {
+    os << ',' << name;
+  }
+  for (const auto& name : count_names) {
+    os << ',' << name;
+  }
+  os << '\n';
+  for (int g = 0; g < GetGenerationCount(); ++g) {
+    os << g;
+    for (const auto& name : time_names) {
+      os << ',' << GetTime(g, name);
+    }
+    for (const auto& name : count_names) {
+      os << ',' << GetCount(g, name);
+    }
+    os << '\n';
+  }
+}
+
+void ProfileLog::WriteJSON(std::ostream& os) const {
+  os << '[';
+  for (int g = 0; g < GetGenerationCount(); ++g) {
+    os << (g == 0 ? "" : ",") << "\n  {\"generation\": " << g
+       << ", \"times\": {";
+    const char* sep = "";
+    for (const auto& [name, seconds] : generations_[g].times) {
+      os << sep << '"' << name << "\": " << seconds;
+      sep = ", ";
+    }
+    os << "}, \"counts\": {";
+    sep = "";
+    for (const auto& [name, count] : generations_[g].counts) {
+      os << sep << '"' << name << "\": " << count;
+      sep = ", ";
+    }
+    os << "}}";
+  }
+  os << "\n]\n";
+}
+
+}  // namespace genericga
@@ -0,0 +1,90 @@
+#include "genericga/random.h"
+
+#include <array>
+#include <atomic>
+#include <cstdint>
+#include <mutex>
+#include <random>
+
+namespace genericga {
+
+namespace {
+
+constexpr std::uint32_t kMultiplier0 = 0xD2511F53u;
+constexpr std::uint32_t kMultiplier1 = 0xCD9E8D57u;
+constexpr std::uint32_t kWeyl0 = 0x9E3779B9u;
+constexpr std::uint32_t kWeyl1 = 0xBB67AE85u;
+constexpr int kRounds = 10;
+
+void MulHiLo(std::uint32_t a, std::uint32_t b, std::uint32_t& hi,
+             std::uint32_t& lo) {
+  std::uint64_t product = static_cast<std::uint64_t>(a) * b;
+  hi = static_cast<std::uint32_t>(product >> 32);
+  lo = static_cast<std::uint32_t>(product);
+}
+
+std::once_flag seed_flag;
+std::uint64_t run_seed = 0;
+std::atomic<std::uint32_t> next_stream{0};
+
+void InitRunSeed() {
+  std::random_device rd;
+  run_seed = (static_cast<std::uint64_t>(rd()) << 32) | rd();
+}
+
+}  // namespace
+
+Philox4x32::Philox4x32(std::uint64_t key, std::uint32_t stream,
+                       std::uint32_t generation, std::uint32_t individual)
+    : key_{static_cast<std::uint32_t>(key),
+           static_cast<std::uint32_t>(key >> 32)},
+      counter_{0, individual, generation, stream} {}
+
+void Philox4x32::Generate() {
+  std::array<std::uint32_t, 4> ctr = counter_;
+  std::array<std::uint32_t, 2> key = key_;
+  for (int round = 0; round < kRounds; ++round) {
+    std::uint32_t hi0, lo0, hi1, lo1;
+    MulHiLo(kMultiplier0, ctr[0], hi0, lo0);
+    MulHiLo(kMultiplier1, ctr[2], hi1, lo1);
+    ctr = {hi1 ^ ctr[1] ^ key[0], lo1, hi0 ^ ctr[3] ^ key[1], lo0};
+    key[0] += kWeyl0;
+    key[1] += kWeyl1;
+  }
+  out_ = ctr;
+  out_index_ = 0;
+  ++counter_[0];
+}
+
+void Philox4x32::discard(unsigned long long n) {
+  for (; n > 0 && out_index_ < 4; --n) {
+    ++out_index_;
+  }
+  counter_[0] += static_cast<std::uint32_t>(n / 4);
+  for (n %= 4; n > 0; --n) {
+    (*this)();
+  }
+}
+
+Philox4x32 Philox4x32::Substream(std::uint32_t generation,
+                                 std::uint32_t individual) const {
+  Philox4x32 sub = *this;
+  sub.counter_ = {0, individual, generation, counter_[3]};
+  sub.out_index_ = 4;
+  return sub;
+}
+
+void SetRunSeed(std::uint64_t seed) {
+  std::call_once(seed_flag, [] {});
+  run_seed = seed;
+  next_stream = 0;
+}
+
+std::uint64_t GetRunSeed() {
+  std::call_once(seed_flag, InitRunSeed);
+  return run_seed;
+}
+
+Philox4x32 MakeStream() { return Philox4x32(GetRunSeed(), next_stream++); }
+
+}  // namespace genericga
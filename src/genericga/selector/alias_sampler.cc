@@ -0,0 +1,73 @@
+#include "genericga/selector/alias_sampler.h"
+
+#include <algorithm>
+#include <cassert>
+#include <cstdint>
+#include <numeric>
+#include <vector>
+
+namespace genericga {
+namespace selector {
+
+namespace {
+
+constexpr double kTwo32 = 4294967296.0;
+
+std::uint64_t ToThreshold(double prob) {
+  return static_cast<std::uint64_t>(std::clamp(prob, 0.0, 1.0) * kTwo32);
+}
+
+}  // namespace
+
+// Vose's algorithm.  Weights are scaled so the average is 1, then each
+// under-full column is topped up by an over-full one, which becomes its alias.
+void AliasSampler::Build() {
+  int size = scaled_.size();
+  assert(size > 0);
+  double total = std::accumulate(scaled_.begin(), scaled_.end(), 0.0);
+  if (total <= 0) {
+    std::fill(scaled_.begin(), scaled_.end(), 1.0);
+    total = size;
+  }
+  for (auto& weight : scaled_) {
+    weight *= size / total;
+  }
+
+  probs_.resize(size);
+  aliases_.resize(size);
+  small_.clear();
+  large_.clear();
+  for (int i = 0; i < size; ++i) {
+    if (scaled_[i] < 1.0) {
+      small_.push_back(i);
+    } else {
+      large_.push_back(i);
+    }
+  }
+  while (!small_.empty() && !large_.empty()) {
+    int less = small_.back();
+    small_.pop_back();
+    int more = large_.back();
+    large_.pop_back();
+    probs_[less] = ToThreshold(scaled_[less]);
+    aliases_[less] = more;
+    scaled_[more] = (scaled_[more] + scaled_[less]) - 1.0;
+    if (scaled_[more] < 1.0) {
+      small_.push_back(more);
+    } else {
+      large_.push_back(more);
+    }
+  }
+  // Whatever is left is full up to rounding error.
+  for (int i : large_) {
+    probs_[i] = ToThreshold(1.0);
+    aliases_[i] = i;
+  }
+  for (int i : small_) {
+    probs_[i] = ToThreshold(1.0);
+    aliases_[i] = i;
+  }
+}
+
+}  // namespace selector
+}  // namespace genericga
@@ -24,5 +24,17 @@ std::vector<int> ElitismDecorator::SelectIndices(
   return rest;
 }
 
+std::vector<int> ElitismDecorator::SelectIndices(
+    const std::vector<float>& fitnesses, const std::vector<int>& counts,
+    const std::vector<int>& ordering, int n) {
+  int actual_n_elites = std::min(n, n_elites_);
+  auto elites =
+      elite_sel_->SelectIndices(fitnesses, counts, ordering, actual_n_elites);
+  auto rest =
+      sel_->SelectIndices(fitnesses, counts, ordering, n - actual_n_elites);
+  rest.insert(rest.end(), elites.begin(), elites.end());
+  return rest;
+}
+
 }  // namespace selector
 }  // namespace genericga
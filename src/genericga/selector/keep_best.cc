@@ -11,9 +11,15 @@ namespace selector {
 std::vector<int> KeepBest::SelectIndices(const std::vector<float>& fitnesses,
                                          const std::vector<int>& counts,
                                          int n) {
+  return SelectIndices(fitnesses, counts, GetOrderings(fitnesses), n);
+}
+
+std::vector<int> KeepBest::SelectIndices(const std::vector<float>& fitnesses,
+                                         const std::vector<int>& counts,
+                                         const std::vector<int>& ordering,
+                                         int n) {
   std::vector<int> selected(n);
-  auto orderings = GetOrderings(fitnesses);
-  auto it = orderings.rbegin();
+  auto it = ordering.rbegin();
   int count = counts[*it];
   for (auto& val : selected) {
     val = *it;
@@ -11,7 +11,13 @@ namespace selector {
 
 std::vector<float> RankedExponential::CalculateWeights(
     const std::vector<float>& fitnesses) const {
-  auto ranks = GetRankingsWithTies(fitnesses, AverageRank);
+  return CalculateWeights(fitnesses, GetOrderings(fitnesses));
+}
+
+std::vector<float> RankedExponential::CalculateWeights(
+    const std::vector<float>& fitnesses,
+    const std::vector<int>& ordering) const {
+  auto ranks = GetRankingsWithTies(fitnesses, ordering, AverageRank);
   std::transform(ranks.begin(), ranks.end(), ranks.begin(),
                  [](float rank) -> float { return 1 - std::exp(-rank); });
   return ranks;
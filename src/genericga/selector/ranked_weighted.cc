@@ -9,7 +9,13 @@ namespace selector {
 
 std::vector<float> RankedWeighted::CalculateWeights(
     const std::vector<float>& fitnesses) const {
-  auto ranks = GetRankingsWithTies(fitnesses, AverageRank);
+  return CalculateWeights(fitnesses, GetOrderings(fitnesses));
+}
+
+std::vector<float> RankedWeighted::CalculateWeights(
+    const std::vector<float>& fitnesses,
+    const std::vector<int>& ordering) const {
+  auto ranks = GetRankingsWithTies(fitnesses, ordering, AverageRank);
   int size = ranks.size();
   std::vector<float> out_vec(size);
   for (int i = 0; i < size; ++i) {
@@ -3,26 +3,46 @@
 #include <random>
 #include <vector>
 
+#include "genericga/checkpoint.h"
+
 namespace genericga {
 namespace selector {
 
-Roulette::Roulette() : gen_(std::random_device()()) {}
+Roulette::Roulette() : gen_(MakeStream()) {}
 Roulette::Roulette(int seed) : gen_(seed) {}
 
 std::vector<int> Roulette::SelectIndices(const std::vector<float>& fitnesses,
                                          const std::vector<int>& counts,
                                          int n) {
-  auto weights = CalculateWeights(fitnesses);
+  return SelectFromWeights(CalculateWeights(fitnesses), counts, n);
+}
+
+std::vector<int> Roulette::SelectIndices(const std::vector<float>& fitnesses,
+                                         const std::vector<int>& counts,
+                                         const std::vector<int>& ordering,
+                                         int n) {
+  return SelectFromWeights(CalculateWeights(fitnesses, ordering), counts, n);
+}
+
+std::vector<int> Roulette::SelectFromWeights(std::vector<float> weights,
+                                             const std::vector<int>& counts,
+                                             int n) {
   for (int i = 0; i < weights.size(); ++i) {
     weights[i] *= counts[i];
   }
-  std::discrete_distribution<> dist(weights.begin(), weights.end());
-  std::vector<int> selected;
-  for (int i = 0; i < n; ++i) {
-    selected.push_back(dist(gen_));
-  }
+  sampler_.Reset(weights);
+  std::vector<int> selected(n);
+  sampler_.Sample(gen_, selected.data(), n);
   return selected;
 }
 
+void Roulette::SaveCheckpoint(std::ostream& os) const {
+  WriteBinary(os, gen_);
+}
+
+void Roulette::LoadCheckpoint(std::istream& is) {
+  ReadBinary(is, &gen_);
+}
+
 }  // namespace selector
 }  // namespace genericga
@@ -4,13 +4,14 @@
 #include <random>
 #include <vector>
 
+#include "genericga/checkpoint.h"
 #include "genericga/vector_ops.h"
 
 namespace genericga {
 namespace selector {
 
 Tournament::Tournament(int tourn_size)
-    : tourn_size_(tourn_size), gen_(std::random_device()()) {}
+    : tourn_size_(tourn_size), gen_(MakeStream()) {}
 
 Tournament::Tournament(int tourn_size, int seed)
     : tourn_size_(tourn_size), gen_(seed) {}
@@ -18,28 +19,42 @@ Tournament::Tournament(int tourn_size, int seed)
 std::vector<int> Tournament::SelectIndices(const std::vector<float>& fitnesses,
                                            const std::vector<int>& counts,
                                            int n) {
-  dist_ = std::discrete_distribution<>(counts.begin(), counts.end());
+  return SelectIndices(fitnesses, counts, GetOrderings(fitnesses), n);
+}
+
+std::vector<int> Tournament::SelectIndices(const std::vector<float>& fitnesses,
+                                           const std::vector<int>& counts,
+                                           const std::vector<int>& ordering,
+                                           int n) {
+  sampler_.Reset(counts);
   std::vector<int> ind_vec(n);
-  std::vector<int> ranks = GetRankingsWithTies(fitnesses, MinRank);
+  std::vector<int> ranks = GetRankingsWithTies(fitnesses, ordering, MinRank);
+  entrants_.resize(n * tourn_size_);
+  sampler_.Sample(gen_, entrants_.data(), entrants_.size());
   for (int i = 0; i < n; ++i) {
-    ind_vec[i] = TournamentRound(ranks, GenerateTournamentIndices());
+    ind_vec[i] =
+        TournamentWinner(ranks, &entrants_[i * tourn_size_], tourn_size_);
   }
   return ind_vec;
 }
 
-int Tournament::TournamentRound(const std::vector<int>& ranks,
-                                std::vector<int> indices) {
-  return *std::max_element(
-      indices.begin(), indices.end(),
-      [&ranks](int i, int j) -> bool { return ranks[i] < ranks[j]; });
+int TournamentWinner(const std::vector<int>& ranks, const int* entrants,
+                     int n_entrants) {
+  int winner = entrants[0];
+  for (int i = 1; i < n_entrants; ++i) {
+    if (ranks[entrants[i]] > ranks[winner]) {
+      winner = entrants[i];
+    }
+  }
+  return winner;
 }
 
-std::vector<int> Tournament::GenerateTournamentIndices() {
-  std::vector<int> tourn_vec(tourn_size_);
-  for (auto& ind : tourn_vec) {
-    ind = dist_(gen_);
-  }
-  return tourn_vec;
+void Tournament::SaveCheckpoint(std::ostream& os) const {
+  WriteBinary(os, gen_);
+}
+
+void Tournament::LoadCheckpoint(std::istream& is) {
+  ReadBinary(is, &gen_);
 }
 
 }  // namespace selector
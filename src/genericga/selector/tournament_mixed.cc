@@ -4,13 +4,15 @@
 #include <random>
 #include <vector>
 
+#include "genericga/checkpoint.h"
+#include "genericga/selector/tournament.h"
 #include "genericga/vector_ops.h"
 
 namespace genericga {
 namespace selector {
 
 TournamentMixed::TournamentMixed(float tourn_size)
-    : gen_(std::random_device()()),
+    : gen_(MakeStream()),
       base_tourn_size_(static_cast<int>(tourn_size)),
       frac_extra_(tourn_size - static_cast<int>(tourn_size)) {}
 
@@ -22,32 +24,43 @@ TournamentMixed::TournamentMixed(float tourn_size, int seed)
 std::vector<int> TournamentMixed::SelectIndices(
     const std::vector<float>& fitnesses, const std::vector<int>& counts,
     int n) {
-  ind_dist_ = std::discrete_distribution<>(counts.begin(), counts.end());
+  return SelectIndices(fitnesses, counts, GetOrderings(fitnesses), n);
+}
+
+std::vector<int> TournamentMixed::SelectIndices(
+    const std::vector<float>& fitnesses, const std::vector<int>& counts,
+    const std::vector<int>& ordering, int n) {
+  sampler_.Reset(counts);
   std::vector<int> ind_vec(n);
-  std::vector<int> ranks = GetRankingsWithTies(fitnesses, MinRank);
+  std::vector<int> ranks = GetRankingsWithTies(fitnesses, ordering, MinRank);
+  int n_entrants = 0;
+  for (int i = 0; i < n; ++i) {
+    n_entrants += TournamentSize(i, n);
+  }
+  entrants_.resize(n_entrants);
+  sampler_.Sample(gen_, entrants_.data(), n_entrants);
+  int offset = 0;
   for (int i = 0; i < n; ++i) {
-    ind_vec[i] = TournamentRound(ranks, GenerateTournamentIndices(i, n));
+    int tourn_size = TournamentSize(i, n);
+    ind_vec[i] = TournamentWinner(ranks, &entrants_[offset], tourn_size);
+    offset += tourn_size;
   }
   return ind_vec;
 }
 
-int TournamentMixed::TournamentRound(const std::vector<int>& ranks,
-                                     std::vector<int> indices) {
-  return *std::max_element(
-      indices.begin(), indices.end(),
-      [&ranks](int i, int j) -> bool { return ranks[i] < ranks[j]; });
+// The first frac_extra_ of the draws get one extra entrant, so the average
+// tournament size matches the fractional size requested.
+int TournamentMixed::TournamentSize(int cur, int n_draws) const {
+  return cur <= frac_extra_ * n_draws ? base_tourn_size_ + 1
+                                      : base_tourn_size_;
 }
 
-std::vector<int> TournamentMixed::GenerateTournamentIndices(int cur, int n_draws) {
-  int tourn_size = base_tourn_size_;
-  if (cur <= frac_extra_ * n_draws) {
-    ++tourn_size;
-  }
-  std::vector<int> tourn_vec(tourn_size);
-  for (auto& ind : tourn_vec) {
-    ind = ind_dist_(gen_);
-  }
-  return tourn_vec;
+void TournamentMixed::SaveCheckpoint(std::ostream& os) const {
+  WriteBinary(os, gen_);
+}
+
+void TournamentMixed::LoadCheckpoint(std::istream& is) {
+  ReadBinary(is, &gen_);
 }
 
 }  // namespace selector
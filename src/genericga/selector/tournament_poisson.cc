@@ -1,16 +1,19 @@
 #include "genericga/selector/tournament_poisson.h"
 
 #include <algorithm>
+#include <numeric>
 #include <random>
 #include <vector>
 
+#include "genericga/checkpoint.h"
+#include "genericga/selector/tournament.h"
 #include "genericga/vector_ops.h"
 
 namespace genericga {
 namespace selector {
 
 TournamentPoisson::TournamentPoisson(float avg_tourn_size)
-    : gen_(std::random_device()()),
+    : gen_(MakeStream()),
       extra_size_dist_(avg_tourn_size - 1) {}
 
 TournamentPoisson::TournamentPoisson(float avg_tourn_size, int seed)
@@ -20,29 +23,35 @@ TournamentPoisson::TournamentPoisson(float avg_tourn_size, int seed)
 std::vector<int> TournamentPoisson::SelectIndices(
     const std::vector<float>& fitnesses, const std::vector<int>& counts,
     int n) {
-  ind_dist_ = std::discrete_distribution<>(counts.begin(), counts.end());
+  return SelectIndices(fitnesses, counts, GetOrderings(fitnesses), n);
+}
+
+std::vector<int> TournamentPoisson::SelectIndices(
+    const std::vector<float>& fitnesses, const std::vector<int>& counts,
+    const std::vector<int>& ordering, int n) {
+  sampler_.Reset(counts);
   std::vector<int> ind_vec(n);
-  std::vector<int> ranks = GetRankingsWithTies(fitnesses, MinRank);
+  std::vector<int> ranks = GetRankingsWithTies(fitnesses, ordering, MinRank);
+  sizes_.resize(n);
+  for (auto& size : sizes_) {
+    size = extra_size_dist_(gen_) + 1;
+  }
+  entrants_.resize(std::accumulate(sizes_.begin(), sizes_.end(), 0));
+  sampler_.Sample(gen_, entrants_.data(), entrants_.size());
+  int offset = 0;
   for (int i = 0; i < n; ++i) {
-    ind_vec[i] = TournamentRound(ranks, GenerateTournamentIndices());
+    ind_vec[i] = TournamentWinner(ranks, &entrants_[offset], sizes_[i]);
+    offset += sizes_[i];
   }
   return ind_vec;
 }
 
-int TournamentPoisson::TournamentRound(const std::vector<int>& ranks,
-                                     std::vector<int> indices) {
-  return *std::max_element(
-      indices.begin(), indices.end(),
-      [&ranks](int i, int j) -> bool { return ranks[i] < ranks[j]; });
+void TournamentPoisson::SaveCheckpoint(std::ostream& os) const {
+  WriteBinary(os, gen_);
 }
 
-std::vector<int> TournamentPoisson::GenerateTournamentIndices() {
-  int n_opponents = extra_size_dist_(gen_);
-  std::vector<int> tourn_vec(n_opponents + 1);
-  for (auto& ind : tourn_vec) {
-    ind = ind_dist_(gen_);
-  }
-  return tourn_vec;
+void TournamentPoisson::LoadCheckpoint(std::istream& is) {
+  ReadBinary(is, &gen_);
 }
 
 }  // namespace selector
@@ -0,0 +1,73 @@
+#include "genericga/trace.h"
+
+#include <atomic>
+#include <iomanip>
+#include <ostream>
+#include <string>
+
+namespace genericga {
+
+namespace {
+
+std::atomic<TraceSink*> active_sink{nullptr};
+
+}  // namespace
+
+void SetTraceSink(TraceSink* sink) { active_sink = sink; }
+
+TraceSink* GetTraceSink() { return active_sink; }
+
+int TraceSink::ThreadIndex() {
+  auto inserted = threads_.emplace(std::this_thread::get_id(), threads_.size());
+  return inserted.first->second;
+}
+
+void TraceSink::AddSpan(const std::string& name, Clock::time_point start,
+                        Clock::time_point end) {
+  std::lock_guard<std::mutex> lock(mutex_);
+  events_.push_back(
+      {'X', name, Micros(start), Micros(end) - Micros(start), ThreadIndex()});
+}
+
+void TraceSink::AddCounter(const std::string& name, double value) {
+  auto now = Clock::now();
+  std::lock_guard<std::mutex> lock(mutex_);
+  events_.push_back({'C', name, Micros(now), value, ThreadIndex()});
+}
+
+int TraceSink::GetEventCount() const {
+  std::lock_guard<std::mutex> lock(mutex_);
+  return events_.size();
+}
+
+void TraceSink::WriteJSON(std::ostream& os) const {
+  std::lock_guard<std::mutex> lock(mutex_);
+  auto flags = os.flags();
+  auto precision = os.precision();
+  os << "{\"traceEvents\": [";
+  const char* sep = "\n  ";
+  for (int thread = 0; thread < static_cast<int>(threads_.size()); ++thread) {
+    os << sep << "{\"name\": \"thread_name\", \"ph\": \"M\", \"pid\": 0, "
+       << "\"tid\": " << thread << ", \"args\": {\"name\": \"thread "
+       << thread << "\"}}";
+    sep = ",\n  ";
+  }
+  for (const auto& event : events_) {
+    os << sep << "{\"name\": \"" << event.name << "\", \"ph\": \""
+       << event.phase << "\", \"pid\": 0, \"tid\": " << event.thread
+       << ", \"ts\": " << std::fixed << std::setprecision(3)
+       << event.timestamp;
+    if (event.phase == 'X') {
+      os << ", \"dur\": " << event.value << '}';
+    } else {
+      os << ", \"args\": {\"value\": " << std::defaultfloat
+         << std::setprecision(9) << event.value << "}}";
+    }
+    sep = ",\n  ";
+  }
+  os << "\n]}\n";
+  os.flags(flags);
+  os.precision(precision);
+}
+
+}  // namespace genericga
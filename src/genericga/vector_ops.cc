@@ -1,5 +1,12 @@
 #include "genericga/vector_ops.h"
 
+#include <algorithm>
+#include <array>
+#include <cstdint>
+#include <cstring>
+#include <numeric>
+#include <vector>
+
 namespace genericga {
 
 int MinRank(int low, int high, int cur) { return low; }
@@ -7,4 +14,74 @@ int MaxRank(int low, int high, int cur) { return high; }
 float AverageRank(int low, int high, int cur) { return (low + high) / 2.0; }
 int CurrentRank(int low, int high, int cur) { return cur; }
 
+namespace {
+
+// Maps a float onto an unsigned key with the same ordering: negative values
+// have all bits flipped, non-negative values just have the sign bit set.
+std::uint32_t FloatKey(float val) {
+  std::uint32_t bits;
+  std::memcpy(&bits, &val, sizeof(bits));
+  return (bits & 0x80000000u) ? ~bits : (bits | 0x80000000u);
+}
+
+// Stable LSD radix sort of indices by vec[index], one byte per pass.  Passes
+// where every key shares the same byte are skipped.
+void RadixSortIndices(const std::vector<float>& vec,
+                      std::vector<int>::iterator first,
+                      std::vector<int>::iterator last) {
+  int size = std::distance(first, last);
+  if (size < 2) {
+    return;
+  }
+  std::vector<std::uint32_t> keys(size);
+  std::vector<std::uint32_t> keys_tmp(size);
+  std::vector<int> inds(first, last);
+  std::vector<int> inds_tmp(size);
+  for (int i = 0; i < size; ++i) {
+    keys[i] = FloatKey(vec[inds[i]]);
+  }
+  for (int shift = 0; shift < 32; shift += 8) {
+    std::array<int, 257> offsets{};
+    for (auto key : keys) {
+      ++offsets[((key >> shift) & 0xFFu) + 1];
+    }
+    if (*std::max_element(offsets.begin(), offsets.end()) == size) {
+      continue;
+    }
+    std::partial_sum(offsets.begin(), offsets.end(), offsets.begin());
+    for (int i = 0; i < size; ++i) {
+      int dest = offsets[(keys[i] >> shift) & 0xFFu]++;
+      keys_tmp[dest] = keys[i];
+      inds_tmp[dest] = inds[i];
+    }
+    keys.swap(keys_tmp);
+    inds.swap(inds_tmp);
+  }
+  std::copy(inds.begin(), inds.end(), first);
+}
+
+}  // namespace
+
+// Float orderings use a radix sort rather than std::sort.  Equal values keep
+// their index order.
+std::vector<int> GetOrderings(const std::vector<float>& vec) {
+  std::vector<int> indices(vec.size());
+  std::iota(indices.begin(), indices.end(), 0);
+  RadixSortIndices(vec, indices.begin(), indices.end());
+  return indices;
+}
+
+// Extends an ordering of the first ordering.size() elements of vec to cover
+// all of vec.  Only the new elements are sorted; they are then merged in, with
+// existing elements first among equal values.
+void MergeOrderings(const std::vector<float>& vec, std::vector<int>& ordering) {
+  int n_old = ordering.size();
+  ordering.resize(vec.size());
+  std::iota(ordering.begin() + n_old, ordering.end(), n_old);
+  RadixSortIndices(vec, ordering.begin() + n_old, ordering.end());
+  std::inplace_merge(ordering.begin(), ordering.begin() + n_old,
+                     ordering.end(),
+                     [&vec](int i1, int i2) { return vec[i1] < vec[i2]; });
+}
+
 }  // namespace genericga
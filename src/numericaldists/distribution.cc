@@ -4,8 +4,73 @@
 #include <cmath>
 #include <vector>
 
+#include <boost/math/constants/constants.hpp>
+#include <eigen3/Eigen/Core>
+#include <eigen3/unsupported/Eigen/SpecialFunctions>
+
+using Eigen::ArrayXd;
+
 namespace numericaldists {
 
+ArrayXd BatchPDF(const boost::math::uniform_distribution<>& dist,
+                 const ArrayXd& xs) {
+  double low = dist.lower();
+  double high = dist.upper();
+  return (xs >= low && xs <= high)
+      .select(ArrayXd::Constant(xs.size(), 1 / (high - low)), 0.0);
+}
+
+ArrayXd BatchCDF(const boost::math::uniform_distribution<>& dist,
+                 const ArrayXd& xs) {
+  double low = dist.lower();
+  double high = dist.upper();
+  return ((xs - low) / (high - low)).max(0.0).min(1.0);
+}
+
+ArrayXd BatchQuantile(const boost::math::uniform_distribution<>& dist,
+                      const ArrayXd& ps) {
+  return dist.lower() + ps * (dist.upper() - dist.lower());
+}
+
+ArrayXd BatchPDF(const boost::math::normal_distribution<>& dist,
+                 const ArrayXd& xs) {
+  using boost::math::double_constants::one_div_root_two_pi;
+  double scale = dist.scale();
+  ArrayXd zs = (xs - dist.mean()) / scale;
+  return (-0.5 * zs.square()).exp() * (one_div_root_two_pi / scale);
+}
+
+ArrayXd BatchCDF(const boost::math::normal_distribution<>& dist,
+                 const ArrayXd& xs) {
+  using boost::math::double_constants::one_div_root_two;
+  ArrayXd zs = (dist.mean() - xs) / dist.scale() * one_div_root_two;
+  return 0.5 * zs.erfc();
+}
+
+// The tails map to infinities, which lower and upper already handle.
+ArrayXd BatchQuantile(const boost::math::normal_distribution<>& dist,
+                      const ArrayXd& ps) {
+  return dist.mean() + dist.scale() * ps.ndtri();
+}
+
+// Unlike boost, which raises domain errors, negative xs have density and
+// probability 0.
+ArrayXd BatchPDF(const boost::math::exponential_distribution<>& dist,
+                 const ArrayXd& xs) {
+  double lambda = dist.lambda();
+  return (xs >= 0).select(lambda * (-lambda * xs).exp(), 0.0);
+}
+
+ArrayXd BatchCDF(const boost::math::exponential_distribution<>& dist,
+                 const ArrayXd& xs) {
+  return -(-dist.lambda() * xs.max(0.0)).expm1();
+}
+
+ArrayXd BatchQuantile(const boost::math::exponential_distribution<>& dist,
+                      const ArrayXd& ps) {
+  return -(-ps).log1p() / dist.lambda();
+}
+
 float lower(const Distribution& dist) {
   float q = quantile(dist, 0);
   return std::isinf(q) ? quantile(dist, 0.000001) : q;
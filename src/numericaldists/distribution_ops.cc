@@ -1,9 +1,14 @@
 #include <algorithm>
+#include <cassert>
 #include <functional>
 #include <numeric>
+#include <vector>
 
 #include "numericaldists/distribution.h"
+#include "numericaldists/distribution_ops.h"
 #include "numericaldists/function_ops.h"
+#include "numericaldists/kernels.h"
+#include "numericaldists/scatter.h"
 
 #include <cmath>
 #include <eigen3/Eigen/Core>
@@ -62,24 +67,7 @@ ArrayXXd PDF2D(const ArrayXd& xs, const ArrayXd& ys, const ArrayXXd& cdf) {
 ArrayXd RandomVariableFunctionCDF(const ArrayXd& xs, const ArrayXd& pdf,
                                   const ArrayXd& func_vals,
                                   const ArrayXd& new_xs) {
-  const int size = xs.size();
-  const int new_size = new_xs.size();
-  const ArrayXd probs = Areas(xs, pdf).tail(size - 1);
-  const ArrayXd f_vals = OverlapMeanPool(func_vals);
-  const double spacing =
-      (new_xs(new_xs.size() - 1) - new_xs(0)) / (new_size - 1);
-  const ArrayXi inds = ((f_vals - new_xs(0)) / spacing)
-                           .max(0)
-                           .min(new_xs.size() - 1)
-                           .ceil()
-                           .cast<int>();
-  ArrayXd f_pdf = ArrayXd::Zero(new_size);
-  for (int i = 0; i < size - 1; ++i) {
-    f_pdf[inds(i)] += probs(i);
-  }
-  std::partial_sum(f_pdf.data(), f_pdf.data() + new_size, f_pdf.data());
-  f_pdf /= f_pdf(f_pdf.size() - 1);
-  return f_pdf;
+  return FunctionCDF(xs, pdf, func_vals, new_xs);
 }
 
 ArrayXd ExpectedValueFunction(const ArrayXd& xs, const ArrayXd& pdf,
@@ -239,4 +227,21 @@ ArrayXd MarginalY(const ArrayXd& xs, const ArrayXd& ys,
   return y_likes;
 }
 
+// Each CDF is clamped to 0 and 1 outside its own range by Interpolate.
+Scatter MixtureCDF(const std::vector<const Scatter*>& cdfs, int n_samples) {
+  assert(!cdfs.empty());
+  double min_x = cdfs[0]->xs(0);
+  double max_x = cdfs[0]->xs(cdfs[0]->xs.size() - 1);
+  for (auto cdf : cdfs) {
+    min_x = std::min(min_x, cdf->xs(0));
+    max_x = std::max(max_x, cdf->xs(cdf->xs.size() - 1));
+  }
+  ArrayXd xs = ArrayXd::LinSpaced(n_samples, min_x, max_x);
+  ArrayXd ys = ArrayXd::Zero(n_samples);
+  for (auto cdf : cdfs) {
+    ys += Interpolate(*cdf, xs);
+  }
+  return {xs, ys / cdfs.size()};
+}
+
 }  // namespace numericaldists
@@ -3,6 +3,7 @@
 #include <numeric>
 
 #include "numericaldists/interval.h"
+#include "numericaldists/kernels.h"
 
 #include <eigen3/Eigen/Dense>
 #include <utility>
@@ -84,8 +85,7 @@ ArrayXd InterpolateWithAlphas(const ArrayXi& inds_l, const ArrayXd& alphas,
 }
 
 ArrayXd Interpolate(Interval x_int, const ArrayXd& ys, const ArrayXd& new_xs) {
-  auto [inds_l, alphas] = GetIndicesAlphas(x_int, new_xs, ys.size());
-  return InterpolateWithAlphas(inds_l, alphas, ys, new_xs);
+  return InterpolateEven(x_int.min, x_int.max, ys, new_xs);
 }
 
 // When interpolating multiple functions using the same xs, only calculate the
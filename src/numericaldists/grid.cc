@@ -25,4 +25,10 @@ std::ostream& operator<<(std::ostream& os, const Grid& grid) {
   return os;
 }
 
+Eigen::ArrayXd StrategyValues(const Grid& grid) {
+  Eigen::ArrayXd values(grid.xs.size() + grid.ys.size() + grid.zs.size());
+  values << grid.xs, grid.ys, grid.zs.reshaped();
+  return values;
+}
+
 }  // namespace numericaldists
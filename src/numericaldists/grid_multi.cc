@@ -30,4 +30,20 @@ std::ostream& operator<<(std::ostream& os, const GridMulti& grid) {
   return os;
 }
 
+Eigen::ArrayXd StrategyValues(const GridMulti& grid) {
+  Eigen::Index size = grid.xs.size() + grid.ys.size();
+  for (const auto& zs : grid.z_sets) {
+    size += zs.size();
+  }
+  Eigen::ArrayXd values(size);
+  values.head(grid.xs.size()) = grid.xs;
+  values.segment(grid.xs.size(), grid.ys.size()) = grid.ys;
+  Eigen::Index pos = grid.xs.size() + grid.ys.size();
+  for (const auto& zs : grid.z_sets) {
+    values.segment(pos, zs.size()) = zs.reshaped();
+    pos += zs.size();
+  }
+  return values;
+}
+
 }  // namespace numericaldists
@@ -0,0 +1,86 @@
+#include "numericaldists/kernels.h"
+
+#include <algorithm>
+#include <cmath>
+#include <numeric>
+
+#include <eigen3/Eigen/Core>
+
+namespace numericaldists {
+
+template <class Scalar>
+ArrayX<Scalar> InterpolateEven(Scalar x_min, Scalar x_max,
+                               const ArrayX<Scalar>& ys,
+                               const ArrayX<Scalar>& new_xs) {
+  int n_inds = ys.size();
+  Scalar span = x_max - x_min;
+  // A grid collapsed to a point, such as the CDF of a constant bid.
+  if (!(span > 0)) {
+    return ArrayX<Scalar>::Constant(new_xs.size(), ys(n_inds - 1));
+  }
+  // Clamping just below the last index keeps the upper neighbour in range.  In
+  // float the offset can round away, hence the explicit clamp on the index.
+  Scalar top = n_inds - 1.000001;
+  ArrayX<Scalar> new_ys(new_xs.size());
+  for (int i = 0; i < new_xs.size(); ++i) {
+    Scalar ind_exact = std::min(
+        std::max((new_xs(i) - x_min) * (n_inds - 1) / span, Scalar(0)), top);
+    int ind = std::min(static_cast<int>(ind_exact), n_inds - 2);
+    Scalar alpha = ind_exact - ind;
+    new_ys(i) = (1 - alpha) * ys(ind) + alpha * ys(ind + 1);
+  }
+  return new_ys;
+}
+
+template <class Scalar>
+Scalar TrapezoidIntegral(const ArrayX<Scalar>& xs, const ArrayX<Scalar>& ys) {
+  int size = xs.size();
+  return ((ys.head(size - 1) + ys.tail(size - 1)) / 2 *
+          (xs.tail(size - 1) - xs.head(size - 1)))
+      .sum();
+}
+
+template <class Scalar>
+ArrayX<Scalar> FunctionCDF(const ArrayX<Scalar>& xs, const ArrayX<Scalar>& pdf,
+                           const ArrayX<Scalar>& func_vals,
+                           const ArrayX<Scalar>& new_xs) {
+  const int size = xs.size();
+  const int new_size = new_xs.size();
+  const ArrayX<Scalar> probs =
+      (pdf.head(size - 1) + pdf.tail(size - 1)) / 2 *
+      (xs.tail(size - 1) - xs.head(size - 1));
+  const ArrayX<Scalar> f_vals =
+      (func_vals.head(size - 1) + func_vals.tail(size - 1)) / 2;
+  const Scalar spacing = (new_xs(new_size - 1) - new_xs(0)) / (new_size - 1);
+  ArrayX<Scalar> f_pdf = ArrayX<Scalar>::Zero(new_size);
+  for (int i = 0; i < size - 1; ++i) {
+    // A constant function puts all its mass on the first point.
+    int ind = 0;
+    if (spacing > 0) {
+      Scalar ind_exact = std::min(
+          std::max((f_vals(i) - new_xs(0)) / spacing, Scalar(0)),
+          Scalar(new_size - 1));
+      ind = std::min(static_cast<int>(std::ceil(ind_exact)), new_size - 1);
+    }
+    f_pdf(ind) += probs(i);
+  }
+  std::partial_sum(f_pdf.data(), f_pdf.data() + new_size, f_pdf.data());
+  f_pdf /= f_pdf(new_size - 1);
+  return f_pdf;
+}
+
+template ArrayX<double> InterpolateEven(double, double, const ArrayX<double>&,
+                                        const ArrayX<double>&);
+template ArrayX<float> InterpolateEven(float, float, const ArrayX<float>&,
+                                       const ArrayX<float>&);
+template double TrapezoidIntegral(const ArrayX<double>&,
+                                  const ArrayX<double>&);
+template float TrapezoidIntegral(const ArrayX<float>&, const ArrayX<float>&);
+template ArrayX<double> FunctionCDF(const ArrayX<double>&,
+                                    const ArrayX<double>&,
+                                    const ArrayX<double>&,
+                                    const ArrayX<double>&);
+template ArrayX<float> FunctionCDF(const ArrayX<float>&, const ArrayX<float>&,
+                                   const ArrayX<float>&, const ArrayX<float>&);
+
+}  // namespace numericaldists
@@ -0,0 +1,337 @@
+#include "numericaldists/piecewise_linear.h"
+
+#include <algorithm>
+#include <cassert>
+#include <cmath>
+#include <utility>
+#include <vector>
+
+#include <eigen3/Eigen/Core>
+
+using Eigen::ArrayXd;
+
+namespace numericaldists {
+
+namespace {
+
+// Gauss-Legendre nodes and weights on [-1, 1] for 1 to 5 points.  Only the
+// non-negative nodes are listed; the rest mirror them.
+const std::vector<std::vector<std::pair<double, double>>> kGaussLegendre{
+    {{0.0, 2.0}},
+    {{0.577350269189625764509148780502, 1.0}},
+    {{0.0, 0.888888888888888888888888888889},
+     {0.774596669241483377035853079956, 0.555555555555555555555555555556}},
+    {{0.339981043584856264802665759103, 0.652145154862546142626936050778},
+     {0.861136311594052575223946488893, 0.347854845137453857373063949222}},
+    {{0.0, 0.568888888888888888888888888889},
+     {0.538469310105683091036314420700, 0.478628670499366468041291514836},
+     {0.906179845938663992797626878299, 0.236926885056189087514264040720}}};
+
+// Appends (x, y) unless it repeats the last point.
+void Append(std::vector<double>& xs, std::vector<double>& ys, double x,
+            double y) {
+  if (!xs.empty() && xs.back() == x && ys.back() == y) {
+    return;
+  }
+  xs.push_back(x);
+  ys.push_back(y);
+}
+
+PiecewiseLinear FromVectors(const std::vector<double>& xs,
+                            const std::vector<double>& ys) {
+  return PiecewiseLinear(Eigen::Map<const ArrayXd>(xs.data(), xs.size()),
+                         Eigen::Map<const ArrayXd>(ys.data(), ys.size()));
+}
+
+}  // namespace
+
+PiecewiseLinear::PiecewiseLinear(ArrayXd xs, ArrayXd ys)
+    : xs_(std::move(xs)), ys_(std::move(ys)) {
+  assert(xs_.size() == ys_.size());
+  assert(xs_.size() > 0);
+}
+
+PiecewiseLinear::PiecewiseLinear(const Scatter& points)
+    : PiecewiseLinear(points.xs, points.ys) {}
+
+double PiecewiseLinear::operator()(double x) const {
+  const double* begin = xs_.data();
+  const double* end = begin + xs_.size();
+  int upper = std::upper_bound(begin, end, x) - begin;
+  if (upper == 0) {
+    return ys_(0);
+  }
+  if (upper == xs_.size()) {
+    return ys_(xs_.size() - 1);
+  }
+  int lower = upper - 1;
+  if (xs_(lower) == x) {
+    return ys_(lower);
+  }
+  double alpha = (x - xs_(lower)) / (xs_(upper) - xs_(lower));
+  return (1 - alpha) * ys_(lower) + alpha * ys_(upper);
+}
+
+ArrayXd PiecewiseLinear::operator()(const ArrayXd& xs) const {
+  return xs.unaryExpr([this](double x) { return (*this)(x); });
+}
+
+double PiecewiseLinear::LeftLimit(double x) const {
+  const double* begin = xs_.data();
+  const double* end = begin + xs_.size();
+  int upper = std::lower_bound(begin, end, x) - begin;
+  if (upper == 0) {
+    return ys_(0);
+  }
+  if (upper == xs_.size()) {
+    return ys_(xs_.size() - 1);
+  }
+  if (xs_(upper) == x) {
+    return ys_(upper);
+  }
+  int lower = upper - 1;
+  double alpha = (x - xs_(lower)) / (xs_(upper) - xs_(lower));
+  return (1 - alpha) * ys_(lower) + alpha * ys_(upper);
+}
+
+PiecewiseLinear PiecewiseLinear::Simplified(double tolerance) const {
+  std::vector<double> xs{xs_(0)};
+  std::vector<double> ys{ys_(0)};
+  int last = xs_.size() - 1;
+  for (int i = 1; i < last; ++i) {
+    double x0 = xs.back();
+    double x2 = xs_(i + 1);
+    if (xs_(i) != x0 && x2 != xs_(i)) {
+      double alpha = (xs_(i) - x0) / (x2 - x0);
+      double line = (1 - alpha) * ys.back() + alpha * ys_(i + 1);
+      if (std::abs(line - ys_(i)) <= tolerance) {
+        continue;
+      }
+    }
+    xs.push_back(xs_(i));
+    ys.push_back(ys_(i));
+  }
+  if (last > 0) {
+    xs.push_back(xs_(last));
+    ys.push_back(ys_(last));
+  }
+  return FromVectors(xs, ys);
+}
+
+double IntegrateProduct(const std::vector<const PiecewiseLinear*>& factors,
+                        double a, double b) {
+  assert(static_cast<int>(factors.size()) <= kMaxProductFactors);
+  assert(static_cast<int>(kGaussLegendre.size()) == kMaxGaussLegendrePoints);
+  int n_nodes = factors.size() / 2 + 1;
+  const auto& rule = kGaussLegendre[n_nodes - 1];
+  int n_factors = factors.size();
+  int n_rule = rule.size();
+
+  std::vector<double> breaks{a, b};
+  for (auto factor : factors) {
+    int mid = breaks.size();
+    for (double x : factor->xs()) {
+      if (a < x && x < b) {
+        breaks.push_back(x);
+      }
+    }
+    std::inplace_merge(breaks.begin() + 1, breaks.begin() + mid,
+                       breaks.end());
+  }
+  std::inplace_merge(breaks.begin(), breaks.begin() + 1, breaks.end());
+  breaks.erase(std::unique(breaks.begin(), breaks.end()), breaks.end());
+
+  // Each factor is linear on each merged segment.  Cursors walk forward to the
+  // piece holding the segment, so evaluation needs no searching.
+  std::vector<int> cursors(factors.size(), 0);
+  std::vector<double> node_vals(2 * n_rule);
+  int n_breaks = breaks.size();
+  double total = 0;
+  for (int i = 0; i + 1 < n_breaks; ++i) {
+    double center = (breaks[i] + breaks[i + 1]) / 2;
+    double half = (breaks[i + 1] - breaks[i]) / 2;
+    std::fill(node_vals.begin(), node_vals.end(), 1.0);
+    for (int f = 0; f < n_factors; ++f) {
+      const ArrayXd& xs = factors[f]->xs();
+      const ArrayXd& ys = factors[f]->ys();
+      int& k = cursors[f];
+      while (k + 1 < xs.size() && xs(k + 1) <= center) {
+        ++k;
+      }
+      double slope = 0;
+      double at_center = ys(k);
+      if (k + 1 < xs.size() && xs(k) <= center) {
+        slope = (ys(k + 1) - ys(k)) / (xs(k + 1) - xs(k));
+        at_center += slope * (center - xs(k));
+      }
+      for (int n = 0; n < n_rule; ++n) {
+        double offset = slope * half * rule[n].first;
+        node_vals[2 * n] *= at_center + offset;
+        node_vals[2 * n + 1] *= at_center - offset;
+      }
+    }
+    double sum = 0;
+    for (int n = 0; n < n_rule; ++n) {
+      double weight = rule[n].second;
+      sum += rule[n].first == 0 ? weight * node_vals[2 * n]
+                                : weight * (node_vals[2 * n] +
+                                            node_vals[2 * n + 1]);
+    }
+    total += sum * half;
+  }
+  return total;
+}
+
+namespace {
+
+// outer(inner(x)), except flat_value(y) where inner is flat at y.
+template <class FlatValue>
+PiecewiseLinear ComposeWith(const PiecewiseLinear& outer,
+                            const PiecewiseLinear& inner,
+                            FlatValue flat_value) {
+  const ArrayXd& in_xs = inner.xs();
+  const ArrayXd& in_ys = inner.ys();
+  const ArrayXd& out_xs = outer.xs();
+  const double* out_begin = out_xs.data();
+  const double* out_end = out_begin + out_xs.size();
+  std::vector<double> xs;
+  std::vector<double> ys;
+  for (int i = 0; i + 1 < in_xs.size(); ++i) {
+    double x0 = in_xs(i);
+    double x1 = in_xs(i + 1);
+    double y0 = in_ys(i);
+    double y1 = in_ys(i + 1);
+    if (y0 == y1) {
+      double flat = flat_value(y0);
+      Append(xs, ys, x0, flat);
+      Append(xs, ys, x1, flat);
+      continue;
+    }
+    bool rising = y0 < y1;
+    // Approaching from inside the segment picks the side of any jump.
+    Append(xs, ys, x0, rising ? outer(y0) : outer.LeftLimit(y0));
+    int first = std::upper_bound(out_begin, out_end, std::min(y0, y1)) -
+                out_begin;
+    int last = std::lower_bound(out_begin, out_end, std::max(y0, y1)) -
+               out_begin;
+    for (int j = 0; j < last - first; ++j) {
+      int k = rising ? first + j : last - 1 - j;
+      double x = x0 + (out_xs(k) - y0) / (y1 - y0) * (x1 - x0);
+      Append(xs, ys, x, outer.ys()(k));
+    }
+    Append(xs, ys, x1, rising ? outer.LeftLimit(y1) : outer(y1));
+  }
+  if (xs.empty()) {
+    Append(xs, ys, in_xs(0), outer(in_ys(0)));
+  }
+  return FromVectors(xs, ys);
+}
+
+// The chance of winning at y against independent bidders with the given bid
+// CDFs, ties going to each tied bidder equally often.  The coefficient of z^t
+// in prod_j (below_j + atom_j z) is the chance that exactly t of them tie and
+// the rest bid less, and each such tie is won with chance 1 / (t + 1).
+double TieWinProbability(const std::vector<const PiecewiseLinear*>& cdfs,
+                         double y) {
+  std::vector<double> coeffs{1};
+  for (auto cdf : cdfs) {
+    double below = cdf->LeftLimit(y);
+    double atom = (*cdf)(y) - below;
+    coeffs.push_back(0);
+    for (int t = coeffs.size() - 1; t > 0; --t) {
+      coeffs[t] = coeffs[t] * below + coeffs[t - 1] * atom;
+    }
+    coeffs[0] *= below;
+  }
+  double prob = 0;
+  int n_coeffs = coeffs.size();
+  for (int t = 0; t < n_coeffs; ++t) {
+    prob += coeffs[t] / (t + 1);
+  }
+  return prob;
+}
+
+}  // namespace
+
+PiecewiseLinear Compose(const PiecewiseLinear& outer,
+                        const PiecewiseLinear& inner) {
+  return ComposeWith(outer, inner, [&outer](double y) {
+    return (outer.LeftLimit(y) + outer(y)) / 2;
+  });
+}
+
+std::vector<PiecewiseLinear> ComposeEach(
+    const std::vector<const PiecewiseLinear*>& outers,
+    const PiecewiseLinear& inner) {
+  std::vector<PiecewiseLinear> composed;
+  composed.reserve(outers.size());
+  int n_outers = outers.size();
+  for (int j = 0; j < n_outers; ++j) {
+    if (j == 0) {
+      composed.push_back(ComposeWith(*outers[0], inner, [&outers](double y) {
+        return TieWinProbability(outers, y);
+      }));
+    } else {
+      composed.push_back(
+          ComposeWith(*outers[j], inner, [](double) { return 1.0; }));
+    }
+  }
+  return composed;
+}
+
+PiecewiseLinear UniformImageCDF(const PiecewiseLinear& func) {
+  const ArrayXd& xs = func.xs();
+  const ArrayXd& ys = func.ys();
+  double length = func.Upper() - func.Lower();
+  assert(length > 0);
+
+  // Each segment adds a ramp of height dx / length across its range of ys,
+  // or a step if it is flat.  Sweep over the changes in slope and steps.
+  struct Event {
+    double y;
+    double slope_change;
+    double step;
+  };
+  std::vector<Event> events;
+  for (int i = 0; i + 1 < xs.size(); ++i) {
+    double mass = (xs(i + 1) - xs(i)) / length;
+    if (mass == 0) {
+      continue;
+    }
+    double low = std::min(ys(i), ys(i + 1));
+    double high = std::max(ys(i), ys(i + 1));
+    if (low == high) {
+      events.push_back({low, 0, mass});
+    } else {
+      events.push_back({low, mass / (high - low), 0});
+      events.push_back({high, -mass / (high - low), 0});
+    }
+  }
+  std::sort(events.begin(), events.end(),
+            [](const Event& e1, const Event& e2) { return e1.y < e2.y; });
+
+  std::vector<double> cdf_xs;
+  std::vector<double> cdf_ys;
+  double value = 0;
+  double slope = 0;
+  double prev_y = events.front().y;
+  int n_events = events.size();
+  for (int i = 0; i < n_events;) {
+    double y = events[i].y;
+    value += slope * (y - prev_y);
+    double step = 0;
+    for (; i < n_events && events[i].y == y; ++i) {
+      slope += events[i].slope_change;
+      step += events[i].step;
+    }
+    Append(cdf_xs, cdf_ys, y, value);
+    value += step;
+    Append(cdf_xs, cdf_ys, y, value);
+    prev_y = y;
+  }
+  // Rounding leaves the top a hair off 1.
+  cdf_ys.back() = 1;
+  return FromVectors(cdf_xs, cdf_ys);
+}
+
+}  // namespace numericaldists
@@ -0,0 +1,109 @@
+#include "numericaldists/quadrature.h"
+
+#include <array>
+#include <cmath>
+#include <queue>
+#include <vector>
+
+#include <eigen3/Eigen/Core>
+
+using Eigen::ArrayXd;
+
+namespace numericaldists {
+
+namespace {
+
+constexpr int kKronrodPoints = 15;
+
+// Non-negative Kronrod abscissae on [-1, 1], largest first.  The odd entries
+// are the 7 point Gauss abscissae.
+constexpr std::array<double, 8> kNodes{
+    0.991455371120812639206854697526329, 0.949107912342758524526189684047851,
+    0.864864423359769072789712788640926, 0.741531185599394439863864773280788,
+    0.586087235467691130294144845693013, 0.405845151377397166906606412076961,
+    0.207784955007898467600689403773245, 0.0};
+constexpr std::array<double, 8> kKronrodWeights{
+    0.022935322010529224963732008058970, 0.063092092629978553290700663189204,
+    0.104790010322250183839876322541518, 0.140653259715525918745189590510238,
+    0.169004726639267902826583426598550, 0.190350578064785409913256402421014,
+    0.204432940075298892414161999234649, 0.209482141084727828012999174891714};
+constexpr std::array<double, 4> kGaussWeights{
+    0.129484966168869693270611432679082, 0.279705391489276667901467771423780,
+    0.381830050505118944950369775488975, 0.417959183673469387755102040816327};
+
+struct Segment {
+  double a;
+  double b;
+  double value;
+  double error;
+  bool operator<(const Segment& other) const { return error < other.error; }
+};
+
+// Writes the 15 Kronrod points of [a, b] into out starting at offset, in the
+// order -x0, x0, -x1, x1, ..., 0.
+void KronrodPoints(double a, double b, ArrayXd& out, int offset) {
+  double center = (a + b) / 2;
+  double half = (b - a) / 2;
+  for (int i = 0; i < 7; ++i) {
+    out(offset + 2 * i) = center - half * kNodes[i];
+    out(offset + 2 * i + 1) = center + half * kNodes[i];
+  }
+  out(offset + 14) = center;
+}
+
+Segment MakeSegment(double a, double b, const ArrayXd& fs, int offset) {
+  double kronrod = kKronrodWeights[7] * fs(offset + 14);
+  double gauss = kGaussWeights[3] * fs(offset + 14);
+  for (int i = 0; i < 7; ++i) {
+    double pair = fs(offset + 2 * i) + fs(offset + 2 * i + 1);
+    kronrod += kKronrodWeights[i] * pair;
+    if (i % 2 == 1) {
+      gauss += kGaussWeights[i / 2] * pair;
+    }
+  }
+  double half = (b - a) / 2;
+  return {a, b, kronrod * half, std::abs((kronrod - gauss) * half)};
+}
+
+}  // namespace
+
+QuadratureResult IntegrateAdaptive(const ArrayFunction& f, double a, double b,
+                                   double tolerance, int max_intervals) {
+  if (a == b) {
+    return {0, 0, 0};
+  }
+  ArrayXd points(kKronrodPoints);
+  KronrodPoints(a, b, points, 0);
+  std::priority_queue<Segment> segments;
+  segments.push(MakeSegment(a, b, f(points), 0));
+  int n_evals = kKronrodPoints;
+  double error = segments.top().error;
+
+  points.resize(2 * kKronrodPoints);
+  while (error > tolerance &&
+         static_cast<int>(segments.size()) < max_intervals) {
+    Segment worst = segments.top();
+    segments.pop();
+    double mid = (worst.a + worst.b) / 2;
+    KronrodPoints(worst.a, mid, points, 0);
+    KronrodPoints(mid, worst.b, points, kKronrodPoints);
+    ArrayXd fs = f(points);
+    n_evals += 2 * kKronrodPoints;
+    Segment left = MakeSegment(worst.a, mid, fs, 0);
+    Segment right = MakeSegment(mid, worst.b, fs, kKronrodPoints);
+    error += left.error + right.error - worst.error;
+    segments.push(left);
+    segments.push(right);
+  }
+
+  // Resum rather than trusting the running total, which drifts.
+  QuadratureResult result{0, 0, n_evals};
+  while (!segments.empty()) {
+    result.value += segments.top().value;
+    result.error += segments.top().error;
+    segments.pop();
+  }
+  return result;
+}
+
+}  // namespace numericaldists
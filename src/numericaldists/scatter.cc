@@ -14,4 +14,10 @@ std::ostream& operator<<(std::ostream& os, const Scatter& points) {
   return os;
 }
 
+Eigen::ArrayXd StrategyValues(const Scatter& points) {
+  Eigen::ArrayXd values(points.xs.size() + points.ys.size());
+  values << points.xs, points.ys;
+  return values;
+}
+
 }  // namespace numericaldists
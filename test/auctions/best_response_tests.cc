@@ -0,0 +1,115 @@
+#include <gtest/gtest.h>
+
+#include "auctions/all_pay.h"
+#include "auctions/best_response.h"
+#include "auctions/first_price.h"
+#include "auctions/second_price.h"
+#include "boost/math/distributions/uniform.hpp"
+#include "genericga/phenotype_strategy.h"
+#include "numericaldists/distribution.h"
+#include "numericaldists/scatter.h"
+
+#include <memory>
+#include <vector>
+
+#include <eigen3/Eigen/Core>
+
+using namespace Eigen;
+
+namespace gatests {
+
+// Two players with values uniform on [0, 1], against the equilibrium bids of
+// each format.
+class BestResponseTest : public ::testing::Test {
+ public:
+  BestResponseTest() {}
+
+ protected:
+  virtual void SetUp() {}
+
+  std::vector<numericaldists::Distribution> dists{
+      boost::math::uniform_distribution<>(0, 1),
+      boost::math::uniform_distribution<>(0, 1)};
+  ArrayXd values = ArrayXd::LinSpaced(101, 0, 1);
+  numericaldists::Scatter first_price_bids = {values, values / 2};
+  numericaldists::Scatter all_pay_bids = {values, values.square() / 2};
+  numericaldists::Scatter second_price_bids = {values, values};
+  // One bid grid step, plus the interpolation of opponents' bid CDFs.
+  double tolerance = 0.005;
+};
+
+TEST_F(BestResponseTest, FirstPriceTest) {
+  auctions::FirstPrice auction(dists, 1001);
+  auction.AcceptStrategy(first_price_bids, 0);
+  auto response = auction.BestResponse(1);
+  ASSERT_EQ(101, response.xs.size());
+  for (int i = 0; i < response.xs.size(); ++i) {
+    EXPECT_NEAR(response.xs(i) / 2, response.ys(i), tolerance);
+  }
+}
+
+TEST_F(BestResponseTest, AllPayTest) {
+  auctions::AllPay auction(dists, 1001);
+  auction.AcceptStrategy(all_pay_bids, 0);
+  auto response = auction.BestResponse(1);
+  // Expected utility is flat near the optimum, so the bids themselves can be
+  // a few grid steps off; what matters is that nothing better is left.
+  EXPECT_NEAR(auction.GetFitness(all_pay_bids, 1),
+              auction.GetFitness(response, 1), 1e-3);
+}
+
+TEST_F(BestResponseTest, SecondPriceTest) {
+  auctions::SecondPrice auction(dists, 1001);
+  // Precalculate needs every player's strategy.
+  auction.AcceptStrategy(second_price_bids, 0);
+  auction.AcceptStrategy(second_price_bids, 1);
+  auto response = auction.BestResponse(1);
+  for (int i = 0; i < response.xs.size(); ++i) {
+    EXPECT_NEAR(response.xs(i), response.ys(i), tolerance);
+  }
+}
+
+TEST_F(BestResponseTest, EquilibriumReportTest) {
+  auctions::FirstPrice auction(dists, 1001);
+  auto report = auctions::GetEquilibriumReport(
+      auction, {first_price_bids, first_price_bids});
+  ASSERT_EQ(2, report.gains.size());
+  EXPECT_NEAR(1.0 / 6, report.fitnesses[0], 1e-3);
+  EXPECT_LT(report.epsilon, 1e-3);
+
+  // Bidding the value earns nothing, while shading to the equilibrium earns
+  // a sixth.
+  auto truthful = auctions::GetEquilibriumReport(
+      auction, {first_price_bids, second_price_bids});
+  EXPECT_NEAR(0, truthful.fitnesses[1], 1e-3);
+  EXPECT_NEAR(1.0 / 6, truthful.best_response_fitnesses[1], 1e-3);
+  EXPECT_NEAR(1.0 / 6, truthful.epsilon, 1e-3);
+}
+
+// Stands in for a sub-GA whose best strategy is fixed.
+struct FixedBidder {
+  int GetID() const { return id; }
+  genericga::PhenotypeStrategy<numericaldists::Scatter> GetBestStrategy()
+      const {
+    return {bids, 0};
+  }
+  int id;
+  numericaldists::Scatter bids;
+};
+
+TEST_F(BestResponseTest, BestResponseGapTest) {
+  auctions::FirstPrice auction(dists, 1001);
+  // Listed out of player order, which the gap must undo.
+  std::vector<std::shared_ptr<FixedBidder>> bidders{
+      std::make_shared<FixedBidder>(FixedBidder{1, second_price_bids}),
+      std::make_shared<FixedBidder>(FixedBidder{0, first_price_bids})};
+  auto gap = auctions::MakeBestResponseGap(auction, bidders);
+  auto report = auctions::GetEquilibriumReport(
+      auction, {first_price_bids, second_price_bids});
+  EXPECT_FLOAT_EQ(report.epsilon, gap());
+
+  bidders[0]->bids = first_price_bids;
+  EXPECT_LT(gap(), 1e-3);
+}
+
+}  // namespace gatests
@@ -5,6 +5,7 @@
 #include "numericaldists/distribution.h"
 #include "numericaldists/function_ops.h"
 
+#include <cmath>
 #include <vector>
 
 #include <eigen3/Eigen/Core>
@@ -27,11 +28,11 @@ class FirstPriceTest : public ::testing::Test {
           boost::math::uniform_distribution<>(0, 1)},
       101);
   float epsilon = 0.0001;
-  numericaldists::Scatter bid_0 = {values, ArrayXd::Zero(1, 101)};
-  numericaldists::Scatter bid_tiny = {values, ArrayXd::Ones(1, 101) * 0.01};
-  numericaldists::Scatter bid_1 = {values, ArrayXd::Ones(1, 101)};
-  numericaldists::Scatter bid_20 = {ArrayXd::LinSpaced(101, 20, 40), ArrayXd::Ones(1, 101) * 20};
-  numericaldists::Scatter bid_202 = {ArrayXd::LinSpaced(101, 40, 60), ArrayXd::Ones(1, 101) * 20.2};
+  numericaldists::Scatter bid_0 = {values, ArrayXd::Zero(101)};
+  numericaldists::Scatter bid_tiny = {values, ArrayXd::Ones(101) * 0.01};
+  numericaldists::Scatter bid_1 = {values, ArrayXd::Ones(101)};
+  numericaldists::Scatter bid_20 = {ArrayXd::LinSpaced(101, 20, 40), ArrayXd::Ones(101) * 20};
+  numericaldists::Scatter bid_202 = {ArrayXd::LinSpaced(101, 40, 60), ArrayXd::Ones(101) * 20.2};
   numericaldists::Scatter bid_opt = {values, ArrayXd::LinSpaced(101, 0, 1) / 2};
   numericaldists::Scatter bid_neg = {values, ArrayXd::LinSpaced(101, 1, 0) / 2};
 };
@@ -88,4 +89,62 @@ TEST_F(FirstPriceTest, BidSegmentTest) {
   EXPECT_NEAR(-0.25, fit, epsilon);
 }
 
+// Uniform values and full-support bids take the exact path, which does not
+// depend on n_internal_samples.
+TEST_F(FirstPriceTest, ExactFitnessTest) {
+  auction = auctions::FirstPrice(
+      std::vector<numericaldists::Distribution>{
+          boost::math::uniform_distribution<>(0, 1),
+          boost::math::uniform_distribution<>(0, 1),
+          boost::math::uniform_distribution<>(0, 1)},
+      11);
+  numericaldists::Scatter bid_two_thirds = {values, values * 2 / 3};
+  auction.AcceptStrategy(bid_two_thirds, 0);
+  auction.AcceptStrategy(bid_two_thirds, 1);
+  EXPECT_NEAR(1.0 / 12, auction.GetFitness(bid_two_thirds, 2), 1e-6);
+  numericaldists::Scatter bid_seg = {ArrayXd::LinSpaced(2, 0, 1),
+                                     ArrayXd::LinSpaced(2, 0, 2.0 / 3)};
+  EXPECT_NEAR(1.0 / 12, auction.GetFitness(bid_seg, 2), 1e-6);
+}
+
+TEST_F(FirstPriceTest, UtilityTest) {
+  auction.AcceptStrategy(bid_opt, 0);
+  auctions::FirstPrice custom = auction;
+  auction.SetUtility(1, auctions::ValueTransform::CRRA(0.5));
+  custom.SetUtility(1, [](double x) { return std::sqrt(x); });
+  float fit = auction.GetFitness(bid_opt, 1);
+  EXPECT_NEAR(custom.GetFitness(bid_opt, 1), fit, 1e-6);
+  // Integral of sqrt(v / 2) * v over [0, 1].
+  EXPECT_NEAR(std::sqrt(0.5) * 0.4, fit, epsilon);
+}
+
+TEST_F(FirstPriceTest, SinglePrecisionTest) {
+  // A bid function ending short of the values keeps off the exact path.
+  numericaldists::Scatter bid_short = {ArrayXd::LinSpaced(101, 0, 0.9),
+                                       ArrayXd::LinSpaced(101, 0, 0.45)};
+  auction.AcceptStrategy(bid_opt, 0);
+  auctions::FirstPrice single = auction;
+  single.SetSinglePrecision(true);
+  EXPECT_NEAR(auction.GetFitness(bid_short, 1),
+              single.GetFitness(bid_short, 1), 1e-5);
+  // The float copies follow later strategies.
+  auction.AcceptStrategy(bid_neg, 0);
+  single.AcceptStrategy(bid_neg, 0);
+  EXPECT_NEAR(auction.GetFitness(bid_short, 1),
+              single.GetFitness(bid_short, 1), 1e-5);
+}
+
+TEST_F(FirstPriceTest, MixTest) {
+  auctions::FirstPrice other = auction;
+  numericaldists::Scatter bid_high = {values, ArrayXd::LinSpaced(101, 0, 0.8)};
+  auction.AcceptStrategy(bid_opt, 0);
+  auction.AcceptStrategy(bid_opt, 1);
+  other.AcceptStrategy(bid_high, 0);
+  other.AcceptStrategy(bid_opt, 1);
+  auto mixed = auctions::FirstPrice::Mix({&auction, &other});
+  float avg_fit =
+      (auction.GetFitness(bid_opt, 1) + other.GetFitness(bid_opt, 1)) / 2;
+  EXPECT_NEAR(avg_fit, mixed.GetFitness(bid_opt, 1), 0.001);
+}
+
 }  // namespace gatests
@@ -0,0 +1,95 @@
+#include <gtest/gtest.h>
+
+#include "auctions/common_value_signal_second.h"
+#include "auctions/signal_value_dist.h"
+#include "genericga/checkpoint.h"
+
+#include <memory>
+#include <sstream>
+#include <thread>
+#include <vector>
+
+#include <eigen3/Eigen/Core>
+
+using namespace Eigen;
+
+namespace gatests {
+
+// Small tables, so each test builds its own quickly.  Every test uses its own
+// epsilon so no test sees another's cached table.
+class SignalValueDistTest : public ::testing::Test {
+ public:
+  SignalValueDistTest() {}
+
+ protected:
+  virtual void SetUp() {}
+  int n_samples = 41;
+};
+
+TEST_F(SignalValueDistTest, CachedMatchesUncachedTest) {
+  for (int n_draws : {2, 3}) {
+    auto shared = auctions::SharedMidpointSpreadPDF(n_draws, 10, n_samples);
+    ArrayXXd fresh = auctions::MidpointSpreadPDF(n_draws, 10, n_samples);
+    ASSERT_EQ(fresh.rows(), shared->rows());
+    ASSERT_EQ(fresh.cols(), shared->cols());
+    EXPECT_TRUE((fresh == *shared).all());
+    // Held tables are handed out again rather than rebuilt.
+    EXPECT_EQ(shared,
+              auctions::SharedMidpointSpreadPDF(n_draws, 10, n_samples));
+  }
+}
+
+TEST_F(SignalValueDistTest, ConcurrentFirstUseTest) {
+  std::vector<std::shared_ptr<const ArrayXXd>> tables(8);
+  std::vector<std::thread> threads;
+  for (int i = 0; i < tables.size(); ++i) {
+    threads.emplace_back([this, &tables, i]() {
+      tables[i] = auctions::SharedMidpointSpreadPDF(2, 20, n_samples);
+    });
+  }
+  for (auto& thread : threads) {
+    thread.join();
+  }
+  ArrayXXd fresh = auctions::MidpointSpreadPDF(2, 20, n_samples);
+  for (const auto& table : tables) {
+    ASSERT_NE(nullptr, table);
+    EXPECT_EQ(tables[0], table);
+  }
+  EXPECT_TRUE((fresh == *tables[0]).all());
+}
+
+TEST_F(SignalValueDistTest, ReleasedTablesAreFreedTest) {
+  auto table = auctions::SharedMidpointSpreadPDF(2, 30, n_samples);
+  std::weak_ptr<const ArrayXXd> weak = table;
+  table.reset();
+  EXPECT_TRUE(weak.expired());
+  // Asking again rebuilds the same values.
+  table = auctions::SharedMidpointSpreadPDF(2, 30, n_samples);
+  EXPECT_TRUE((auctions::MidpointSpreadPDF(2, 30, n_samples) == *table).all());
+}
+
+TEST_F(SignalValueDistTest, LoadedStrategiesTest) {
+  ArrayXd precs = ArrayXd::LinSpaced(n_samples, 0, 20);
+  numericaldists::Scatter func{ArrayXd::LinSpaced(3, 0, 20), ArrayXd::Zero(3)};
+  numericaldists::Scatter unset;
+  auctions::CheckLoadedStrategies({func, unset}, {0, 0}, precs);
+
+  numericaldists::Scatter ragged{ArrayXd::LinSpaced(3, 0, 20),
+                                 ArrayXd::Zero(2)};
+  numericaldists::Scatter wide{ArrayXd::LinSpaced(3, 0, 40), ArrayXd::Zero(3)};
+  for (const auto& bad : {ragged, wide}) {
+    EXPECT_THROW(auctions::CheckLoadedStrategies({func, bad}, {0, 0}, precs),
+                 genericga::CheckpointError);
+  }
+  EXPECT_THROW(auctions::CheckLoadedStrategies({func, unset}, {0}, precs),
+               genericga::CheckpointError);
+
+  // A checkpoint from a three player auction does not load into two.
+  auctions::CommonValueSignalSecond three({1, 1, 1}, 10, {-40, 10}, n_samples);
+  std::stringstream checkpoint;
+  three.SaveCheckpoint(checkpoint);
+  auctions::CommonValueSignalSecond two({1, 1}, 10, {-40, 10}, n_samples);
+  EXPECT_THROW(two.LoadCheckpoint(checkpoint), genericga::CheckpointError);
+}
+
+}  // namespace gatests
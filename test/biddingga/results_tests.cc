@@ -0,0 +1,127 @@
+#include <gtest/gtest.h>
+
+#include <cstdint>
+#include <cstdio>
+#include <fstream>
+#include <sstream>
+#include <string>
+#include <vector>
+
+#include "biddingga/results.h"
+
+#include <eigen3/Eigen/Core>
+
+namespace gatests {
+
+using namespace biddingga;
+
+class ResultsTest : public ::testing::Test {
+ public:
+  ResultsTest() {}
+
+ protected:
+  virtual void SetUp() {
+    snapshot.round = 10;
+    snapshot.Add("x_0", Eigen::ArrayXd::LinSpaced(3, 0, 1));
+    snapshot.Add("fitness", std::vector<float>{0.25, -1});
+  }
+  ResultsSnapshot snapshot;
+};
+
+TEST_F(ResultsTest, RoundTripTest) {
+  std::stringstream ss;
+  WriteResultsHeader(ss, 1234567890123ull);
+  WriteSnapshot(ss, snapshot);
+  snapshot.round = 20;
+  WriteSnapshot(ss, snapshot);
+
+  std::uint64_t seed = 0;
+  ASSERT_TRUE(ReadResultsHeader(ss, &seed));
+  EXPECT_EQ(1234567890123ull, seed);
+  ResultsSnapshot read;
+  ASSERT_TRUE(ReadSnapshot(ss, &read));
+  EXPECT_EQ(10, read.round);
+  EXPECT_EQ(snapshot.names, read.names);
+  EXPECT_EQ(snapshot.columns, read.columns);
+  ASSERT_TRUE(ReadSnapshot(ss, &read));
+  EXPECT_EQ(20, read.round);
+  EXPECT_FALSE(ReadSnapshot(ss, &read));
+}
+
+TEST_F(ResultsTest, UnseededHeaderTest) {
+  std::stringstream ss("BGARES01");
+  std::uint64_t seed = 7;
+  ASSERT_TRUE(ReadResultsHeader(ss, &seed));
+  EXPECT_EQ(0, seed);
+  std::stringstream other("BGACKP03");
+  EXPECT_FALSE(ReadResultsHeader(other));
+}
+
+TEST_F(ResultsTest, CSVTest) {
+  std::ostringstream os;
+  WriteSnapshotCSV(os, snapshot);
+  EXPECT_EQ("0,0.5,1\n0.25,-1\n", os.str());
+}
+
+TEST_F(ResultsTest, WriterTest) {
+  std::string path = "results_tests.results";
+  {
+    ResultsWriter writer(path, 5);
+    EXPECT_EQ(5, writer.GetSnapshotFrequency());
+    for (int round = 5; round <= 100; round += 5) {
+      snapshot.round = round;
+      writer.Write(snapshot);
+    }
+  }
+  std::ifstream in(path, std::ifstream::binary);
+  ASSERT_TRUE(ReadResultsHeader(in));
+  ResultsSnapshot read;
+  int count = 0;
+  while (ReadSnapshot(in, &read)) {
+    EXPECT_EQ(5 * ++count, read.round);
+  }
+  EXPECT_EQ(20, count);
+  in.close();
+  std::remove(path.c_str());
+}
+
+TEST_F(ResultsTest, UnwritableTest) {
+  ResultsWriter writer("no_such_dir/results_tests.results");
+  EXPECT_FALSE(writer.IsOpen());
+  writer.Write(snapshot);
+  EXPECT_FALSE(writer.Flush());
+}
+
+TEST_F(ResultsTest, ResumeTest) {
+  std::string path = "results_tests_resume.results";
+  {
+    ResultsWriter writer(path, 1, std::uint64_t{42});
+    for (int round = 1; round <= 10; ++round) {
+      snapshot.round = round;
+      writer.Write(snapshot);
+    }
+  }
+  {
+    // As if resumed from a checkpoint after round 6.  The original seed is
+    // kept.
+    ResultsWriter writer(path, 1, 6, 99);
+    for (int round = 7; round <= 8; ++round) {
+      snapshot.round = round;
+      writer.Write(snapshot);
+    }
+  }
+  std::ifstream in(path, std::ifstream::binary);
+  std::uint64_t seed = 0;
+  ASSERT_TRUE(ReadResultsHeader(in, &seed));
+  EXPECT_EQ(42, seed);
+  ResultsSnapshot read;
+  int count = 0;
+  while (ReadSnapshot(in, &read)) {
+    EXPECT_EQ(++count, read.round);
+  }
+  EXPECT_EQ(8, count);
+  in.close();
+  std::remove(path.c_str());
+}
+
+}  // namespace gatests
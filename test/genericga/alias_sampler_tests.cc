@@ -0,0 +1,58 @@
+#include <gtest/gtest.h>
+
+#include <random>
+#include <vector>
+
+#include "genericga/selector/alias_sampler.h"
+
+namespace gatests {
+
+using namespace genericga::selector;
+
+class AliasSamplerTest : public ::testing::Test {
+ public:
+  AliasSamplerTest() {}
+
+ protected:
+  virtual void SetUp() {}
+  std::mt19937 gen = std::mt19937(12345);
+  int n_draws = 200000;
+};
+
+TEST_F(AliasSamplerTest, MatchesWeightsTest) {
+  std::vector<float> weights{1, 0, 3, 4, 2};
+  AliasSampler sampler(weights);
+  std::vector<int> draws(n_draws);
+  sampler.Sample(gen, draws.data(), n_draws);
+  std::vector<int> counts(weights.size(), 0);
+  for (int draw : draws) {
+    ++counts[draw];
+  }
+  float epsilon = 0.005;
+  EXPECT_EQ(0, counts[1]);
+  EXPECT_NEAR(0.1, counts[0] / static_cast<float>(n_draws), epsilon);
+  EXPECT_NEAR(0.3, counts[2] / static_cast<float>(n_draws), epsilon);
+  EXPECT_NEAR(0.4, counts[3] / static_cast<float>(n_draws), epsilon);
+  EXPECT_NEAR(0.2, counts[4] / static_cast<float>(n_draws), epsilon);
+}
+
+TEST_F(AliasSamplerTest, ResetTest) {
+  AliasSampler sampler(std::vector<int>{5, 5});
+  sampler.Reset(std::vector<int>{0, 0, 7});
+  for (int i = 0; i < 1000; ++i) {
+    EXPECT_EQ(2, sampler(gen));
+  }
+}
+
+TEST_F(AliasSamplerTest, AllZeroUniformTest) {
+  AliasSampler sampler(std::vector<float>{0, 0, 0, 0});
+  std::vector<int> counts(4, 0);
+  for (int i = 0; i < n_draws; ++i) {
+    ++counts[sampler(gen)];
+  }
+  for (int count : counts) {
+    EXPECT_NEAR(0.25, count / static_cast<float>(n_draws), 0.005);
+  }
+}
+
+}  // namespace gatests
@@ -0,0 +1,163 @@
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <memory>
+#include <mutex>
+#include <stdexcept>
+#include <thread>
+#include <vector>
+
+#include "genericga/multipop/abstract_sub_ga.h"
+#include "genericga/multipop/convergence.h"
+#include "genericga/multipop/ga.h"
+#include "genericga/multipop/snapshot_buffer.h"
+
+namespace gatests {
+
+using namespace genericga;
+using multipop::SnapshotBuffer;
+
+// Counts the strategies each player has submitted.
+struct CountingEnvironment {
+  std::vector<int> counts = std::vector<int>(3, 0);
+};
+
+// Records what each round's environment showed, and whether any round saw
+// another player's submissions lag its own by more than the staleness bound.
+// Player 0 is slow, so the others run ahead until the bound holds them back.
+class CountingSubGA : public multipop::AbstractSubGA<CountingEnvironment> {
+ public:
+  CountingSubGA(int id, int max_staleness)
+      : multipop::AbstractSubGA<CountingEnvironment>(id),
+        max_staleness_(max_staleness) {}
+
+  void RunRound(const std::vector<CountingEnvironment*>& envs) override {
+    std::vector<const CountingEnvironment*> const_envs(envs.begin(),
+                                                        envs.end());
+    RunRound(const_envs);
+  }
+  void RunRound(const std::vector<const CountingEnvironment*>& envs) override {
+    const auto& counts = envs[0]->counts;
+    // The initial submission plus one per finished round.
+    int own = counts[GetID()];
+    if (own != rounds_ + 1) {
+      own_visible_ = false;
+    }
+    for (int count : counts) {
+      if (own - count > max_staleness_) {
+        within_staleness_ = false;
+      }
+    }
+    if (GetID() == 0) {
+      std::this_thread::sleep_for(std::chrono::milliseconds(2));
+    }
+    ++rounds_;
+  }
+  void SubmitPlayStrat(CountingEnvironment& env) override {
+    ++env.counts[GetID()];
+  }
+  void SaveCheckpoint(std::ostream& os) const override {}
+  void LoadCheckpoint(std::istream& is) override {}
+  multipop::StrategyChange GetLastChange() const override { return {}; }
+
+  int GetRounds() const { return rounds_; }
+  bool GetOwnVisible() const { return own_visible_; }
+  bool GetWithinStaleness() const { return within_staleness_; }
+
+ private:
+  int max_staleness_;
+  int rounds_ = 0;
+  bool own_visible_ = true;
+  bool within_staleness_ = true;
+};
+
+class AsyncTest : public ::testing::Test {
+ public:
+  AsyncTest() {}
+
+ protected:
+  virtual void SetUp() {}
+  void RunAsync(int n_rounds, int max_staleness) {
+    std::vector<std::shared_ptr<multipop::AbstractSubGA<CountingEnvironment>>>
+        gas;
+    for (int id = 0; id < 3; ++id) {
+      sub_gas_.push_back(std::make_shared<CountingSubGA>(id, max_staleness));
+      gas.push_back(sub_gas_.back());
+    }
+    multipop::GA<CountingEnvironment> driver(gas, CountingEnvironment());
+    driver.RunRoundAsync(n_rounds, max_staleness);
+    round_count_ = driver.GetRoundCount();
+  }
+
+  std::vector<std::shared_ptr<CountingSubGA>> sub_gas_;
+  int round_count_ = 0;
+};
+
+TEST_F(AsyncTest, SnapshotVisibilityTest) {
+  SnapshotBuffer<std::vector<int>> buffer({1, 2});
+  auto first = buffer.Load();
+  EXPECT_EQ(first->version, 0);
+  long version = buffer.Update([](std::vector<int>& v) { v.push_back(3); });
+  EXPECT_EQ(version, 1);
+  auto second = buffer.Load();
+  EXPECT_EQ(second->version, 1);
+  EXPECT_EQ(second->value, std::vector<int>({1, 2, 3}));
+  // Earlier snapshots are unchanged by later publishes.
+  EXPECT_EQ(first->value, std::vector<int>({1, 2}));
+}
+
+TEST_F(AsyncTest, SnapshotConcurrentUpdateTest) {
+  SnapshotBuffer<int> buffer(0);
+  std::vector<std::thread> threads;
+  for (int t = 0; t < 4; ++t) {
+    threads.emplace_back([&buffer]() {
+      for (int i = 0; i < 250; ++i) {
+        buffer.Update([](int& v) { ++v; });
+        auto snapshot = buffer.Load();
+        EXPECT_EQ(snapshot->value, snapshot->version);
+      }
+    });
+  }
+  for (auto& thread : threads) {
+    thread.join();
+  }
+  EXPECT_EQ(buffer.Load()->value, 1000);
+  EXPECT_EQ(buffer.Load()->version, 1000);
+}
+
+TEST_F(AsyncTest, CompletionTest) {
+  RunAsync(20, 1);
+  EXPECT_EQ(round_count_, 20);
+  for (const auto& ga : sub_gas_) {
+    EXPECT_EQ(ga->GetRounds(), 20);
+    // Each round sees every earlier publish of the sub-GA's own strategy.
+    EXPECT_TRUE(ga->GetOwnVisible());
+  }
+}
+
+TEST_F(AsyncTest, StalenessBoundTest) {
+  for (int max_staleness : {0, 2}) {
+    sub_gas_.clear();
+    RunAsync(20, max_staleness);
+    for (const auto& ga : sub_gas_) {
+      EXPECT_TRUE(ga->GetWithinStaleness()) << max_staleness;
+    }
+  }
+}
+
+TEST_F(AsyncTest, BadArgumentsTest) {
+  std::vector<std::shared_ptr<multipop::AbstractSubGA<CountingEnvironment>>>
+      gas{std::make_shared<CountingSubGA>(0, 0)};
+  multipop::GA<CountingEnvironment> driver(gas, CountingEnvironment());
+  EXPECT_THROW(driver.RunRoundAsync(1, -1), std::invalid_argument);
+  EXPECT_EQ(0, driver.GetRoundCount());
+
+  // Nothing to run, rather than a division by the sub-GA count.
+  multipop::GA<CountingEnvironment> empty({}, CountingEnvironment());
+  empty.RunRoundAsync(3);
+  EXPECT_EQ(0, empty.GetRoundCount());
+}
+
+}  // namespace gatests
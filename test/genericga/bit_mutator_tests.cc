@@ -0,0 +1,64 @@
+#include <gtest/gtest.h>
+
+#include <bitset>
+#include <vector>
+
+#include "genericga/binary/bit_mutator.h"
+#include "genericga/binary/byte_array_genotype.h"
+#include "genericga/random.h"
+
+namespace gatests {
+
+using namespace genericga;
+using namespace genericga::binary;
+
+class BitMutatorTest : public ::testing::Test {
+ public:
+  BitMutatorTest() {}
+
+ protected:
+  virtual void SetUp() {
+    genes = std::vector<ByteArrayGenotype>(
+        n_genes, ByteArrayGenotype(std::vector<unsigned char>(n_bytes, 0)));
+  }
+  int CountSetBits() {
+    int count = 0;
+    for (auto& gene : genes) {
+      for (int i = 0; i < gene.NBytes(); ++i) {
+        count += std::bitset<8>(gene[i]).count();
+      }
+    }
+    return count;
+  }
+  int n_genes = 1000;
+  int n_bytes = 44;
+  std::vector<ByteArrayGenotype> genes;
+  Philox4x32 stream = Philox4x32(2024);
+};
+
+TEST_F(BitMutatorTest, GeometricSkipRateTest) {
+  auto gen = stream.Substream(0, 0);
+  GeometricSkipFlip(genes, 0.01, gen);
+  double expected = 0.01 * n_genes * n_bytes * 8;
+  EXPECT_NEAR(expected, CountSetBits(), 0.1 * expected);
+}
+
+TEST_F(BitMutatorTest, GeometricSkipEdgeRatesTest) {
+  auto gen = stream.Substream(0, 0);
+  GeometricSkipFlip(genes, 0, gen);
+  EXPECT_EQ(0, CountSetBits());
+  GeometricSkipFlip(genes, 1, gen);
+  EXPECT_EQ(n_genes * n_bytes * 8, CountSetBits());
+}
+
+TEST_F(BitMutatorTest, MutateAllReproducibleTest) {
+  BitMutator mutator(2, true);
+  auto copy = genes;
+  mutator.MutateAll(genes, stream, 3);
+  mutator.MutateAll(copy, stream, 3);
+  EXPECT_EQ(genes, copy);
+  double expected = 2.0 * n_genes;
+  EXPECT_NEAR(expected, CountSetBits(), 0.1 * expected);
+}
+
+}  // namespace gatests
@@ -0,0 +1,168 @@
+#include <gtest/gtest.h>
+
+#include <array>
+#include <cstdint>
+#include <cmath>
+#include <functional>
+#include <istream>
+#include <memory>
+#include <ostream>
+#include <sstream>
+#include <string>
+#include <vector>
+
+#include "genericga/binary/byte_array_genotype.h"
+#include "genericga/checkpoint.h"
+#include "genericga/multipop/ga.h"
+#include "genericga/multipop/sub_ga_adapter.h"
+#include "genericga/population.h"
+#include "genericga/random.h"
+#include "genericga/single_population_ga.h"
+
+#include "float_ga.h"
+
+namespace gatests {
+
+using namespace genericga;
+using binary::ByteArrayGenotype;
+
+// Two players, each rewarded for bidding close to the other.
+class MatchingEnvironment {
+ public:
+  void AcceptStrategy(float bid, int id) { bids_[id] = bid; }
+  float GetFitness(float bid, int id) const {
+    return -std::abs(bid - bids_[1 - id]);
+  }
+  void SaveCheckpoint(std::ostream& os) const { WriteBinary(os, bids_); }
+  void LoadCheckpoint(std::istream& is) { ReadBinary(is, &bids_); }
+
+ private:
+  std::array<float, 2> bids_{};
+};
+
+using SubGA = multipop::SubGAAdapter<MatchingEnvironment, float>;
+
+class CheckpointTest : public ::testing::Test {
+ public:
+  CheckpointTest() {}
+
+ protected:
+  virtual void SetUp() {}
+  // Batches of two from a memory of three, so resuming has to restore the
+  // memory ring and the driver's sampling stream too.
+  static multipop::GA<MatchingEnvironment> MakeDriver(
+      std::vector<std::shared_ptr<SubGA>>* sub_gas) {
+    std::vector<std::shared_ptr<multipop::AbstractSubGA<MatchingEnvironment>>>
+        gas;
+    for (int id = 0; id < 2; ++id) {
+      sub_gas->push_back(std::make_shared<SubGA>(MakeFloatGA(), id));
+      gas.push_back(sub_gas->back());
+    }
+    return multipop::GA<MatchingEnvironment>(gas, MatchingEnvironment(), 2,
+                                              3);
+  }
+};
+
+TEST_F(CheckpointTest, ResumeTest) {
+  SetRunSeed(7);
+  std::vector<std::shared_ptr<SubGA>> original_gas;
+  auto original = MakeDriver(&original_gas);
+  original.RunRound(5);
+  std::stringstream checkpoint;
+  original.SaveCheckpoint(checkpoint);
+  original.RunRound(5);
+
+  // A different seed, so everything that matches comes from the checkpoint.
+  SetRunSeed(8);
+  std::vector<std::shared_ptr<SubGA>> resumed_gas;
+  auto resumed = MakeDriver(&resumed_gas);
+  resumed.LoadCheckpoint(checkpoint);
+  EXPECT_EQ(5, resumed.GetRoundCount());
+  resumed.RunRound(5);
+
+  EXPECT_EQ(10, resumed.GetRoundCount());
+  for (int id = 0; id < 2; ++id) {
+    auto expected = original_gas[id]->GetBestStrategies(20);
+    auto actual = resumed_gas[id]->GetBestStrategies(20);
+    for (int i = 0; i < 20; ++i) {
+      EXPECT_EQ(expected[i].phenotype, actual[i].phenotype);
+      EXPECT_EQ(expected[i].fitness, actual[i].fitness);
+    }
+  }
+}
+
+TEST_F(CheckpointTest, MissingFileTest) {
+  std::vector<std::shared_ptr<SubGA>> gas;
+  auto driver = MakeDriver(&gas);
+  EXPECT_FALSE(driver.LoadCheckpointFile("no_such_checkpoint"));
+  EXPECT_EQ(0, driver.GetRoundCount());
+}
+
+TEST_F(CheckpointTest, TruncatedTest) {
+  std::vector<std::shared_ptr<SubGA>> original_gas;
+  auto original = MakeDriver(&original_gas);
+  original.RunRound(2);
+  std::stringstream checkpoint;
+  original.SaveCheckpoint(checkpoint);
+  std::string bytes = checkpoint.str();
+  std::stringstream truncated(bytes.substr(0, bytes.size() / 2));
+
+  std::vector<std::shared_ptr<SubGA>> gas;
+  auto driver = MakeDriver(&gas);
+  EXPECT_THROW(driver.LoadCheckpoint(truncated), CheckpointError);
+}
+
+TEST_F(CheckpointTest, ForeignFileTest) {
+  std::stringstream foreign("BGARES02 is a results file, not a checkpoint");
+  std::vector<std::shared_ptr<SubGA>> gas;
+  auto driver = MakeDriver(&gas);
+  EXPECT_THROW(driver.LoadCheckpoint(foreign), CheckpointError);
+}
+
+TEST_F(CheckpointTest, CorruptLengthTest) {
+  std::stringstream huge;
+  WriteBinary(huge, std::int64_t{1} << 40);
+  WriteBinary(huge, 1.0);
+  std::vector<double> values;
+  EXPECT_THROW(ReadBinary(huge, &values), CheckpointError);
+  huge.seekg(0);
+  Eigen::ArrayXd array;
+  EXPECT_THROW(ReadBinary(huge, &array), CheckpointError);
+
+  // Longer than the data, but small enough to allocate.
+  std::stringstream short_vector;
+  WriteBinary(short_vector, std::vector<double>{1, 2, 3});
+  std::string bytes = short_vector.str();
+  std::stringstream truncated(bytes.substr(0, bytes.size() - 1));
+  EXPECT_THROW(ReadBinary(truncated, &values), CheckpointError);
+}
+
+TEST_F(CheckpointTest, CorruptOrderingTest) {
+  using RealGen = std::vector<double>;
+  std::function<RealGen(const RealGen&)> identity = [](const RealGen& g) {
+    return g;
+  };
+  std::function<std::vector<float>(const std::vector<RealGen>&)> fitness =
+      [](const std::vector<RealGen>& phens) {
+        return std::vector<float>(phens.size(), 0);
+      };
+  Population<RealGen, RealGen> pop(identity, fitness, {{0.25}, {0.75}});
+  for (const auto& ordering :
+       {std::vector<int>{1, 1}, std::vector<int>{0, 2}, std::vector<int>{0}}) {
+    std::stringstream checkpoint;
+    WriteBinary(checkpoint, std::vector<RealGen>{{0.5}, {0.75}});
+    WriteBinary(checkpoint, std::vector<float>{0, 0});
+    WriteBinary(checkpoint, std::vector<int>{1, 1});
+    WriteBinary(checkpoint, ordering);
+    EXPECT_THROW(pop.LoadCheckpoint(checkpoint), CheckpointError);
+  }
+}
+
+TEST_F(CheckpointTest, UnwritableFileTest) {
+  std::vector<std::shared_ptr<SubGA>> gas;
+  auto driver = MakeDriver(&gas);
+  EXPECT_THROW(driver.SaveCheckpointFile("no_such_dir/checkpoint"),
+               CheckpointError);
+}
+
+}  // namespace gatests
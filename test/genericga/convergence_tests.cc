@@ -0,0 +1,126 @@
+#include <gtest/gtest.h>
+
+#include <cmath>
+#include <limits>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "genericga/binary/byte_array_genotype.h"
+#include "genericga/multipop/convergence.h"
+#include "genericga/multipop/ga.h"
+#include "genericga/multipop/sub_ga_adapter.h"
+#include "genericga/population.h"
+#include "genericga/random.h"
+#include "genericga/single_population_ga.h"
+#include "numericaldists/grid.h"
+
+#include "float_ga.h"
+
+#include <eigen3/Eigen/Core>
+
+namespace gatests {
+
+using namespace genericga;
+using binary::ByteArrayGenotype;
+
+// Every player is rewarded for bidding close to a quarter, whatever the
+// others do, so the best strategies settle once the GAs find it.
+class TargetEnvironment {
+ public:
+  void AcceptStrategy(float bid, int id) {}
+  float GetFitness(float bid, int id) const { return -std::abs(bid - 0.25f); }
+};
+
+using SubGA = multipop::SubGAAdapter<TargetEnvironment, float>;
+
+class ConvergenceTest : public ::testing::Test {
+ public:
+  ConvergenceTest() {}
+
+ protected:
+  virtual void SetUp() { SetRunSeed(11); }
+  static multipop::GA<TargetEnvironment> MakeDriver() {
+    std::vector<std::shared_ptr<multipop::AbstractSubGA<TargetEnvironment>>>
+        gas;
+    for (int id = 0; id < 2; ++id) {
+      gas.push_back(std::make_shared<SubGA>(MakeFloatGA(true), id));
+    }
+    return multipop::GA<TargetEnvironment>(gas, TargetEnvironment());
+  }
+};
+
+TEST_F(ConvergenceTest, StrategyChangeTest) {
+  multipop::StrategyChange change;
+  multipop::MeasureStrategyChange(0.5f, 0.25f, &change);
+  EXPECT_DOUBLE_EQ(0.25, change.strategy_linf);
+  EXPECT_DOUBLE_EQ(0.25, change.strategy_l2);
+
+  Eigen::ArrayXd before(2);
+  before << 0, 1;
+  Eigen::ArrayXd after(2);
+  after << 3, 5;
+  multipop::MeasureStrategyChange(before, after, &change);
+  EXPECT_DOUBLE_EQ(4, change.strategy_linf);
+  EXPECT_DOUBLE_EQ(5, change.strategy_l2);
+
+  multipop::MeasureStrategyChange(before, Eigen::ArrayXd(3), &change);
+  EXPECT_EQ(std::numeric_limits<double>::infinity(), change.strategy_linf);
+
+  numericaldists::Grid grid{before, after, Eigen::ArrayXXd::Zero(2, 2)};
+  numericaldists::Grid moved = grid;
+  moved.zs(1, 0) = 0.5;
+  multipop::MeasureStrategyChange(grid, moved, &change);
+  EXPECT_DOUBLE_EQ(0.5, change.strategy_linf);
+
+  // Phenotypes without StrategyValues never look settled.
+  multipop::MeasureStrategyChange(std::string("a"), std::string("a"),
+                                  &change);
+  EXPECT_EQ(std::numeric_limits<double>::infinity(), change.strategy_linf);
+}
+
+TEST_F(ConvergenceTest, RunUntilConvergedTest) {
+  auto driver = MakeDriver();
+  EXPECT_FALSE(driver.HasConverged());
+  multipop::ConvergenceCriteria criteria{0.01, 0.01, 5};
+  driver.SetConvergenceCriteria(criteria);
+  EXPECT_TRUE(driver.RunUntilConverged(500));
+  EXPECT_LT(driver.GetRoundCount(), 500);
+  EXPECT_GE(driver.GetStableRoundCount(), 5);
+  for (const auto& change : driver.GetLastChanges()) {
+    EXPECT_TRUE(criteria.IsStable(change));
+  }
+  // Converged runs do not run further.
+  int rounds = driver.GetRoundCount();
+  EXPECT_TRUE(driver.RunUntilConverged(500));
+  EXPECT_EQ(rounds, driver.GetRoundCount());
+}
+
+TEST_F(ConvergenceTest, BestResponseGapTest) {
+  auto driver = MakeDriver();
+  multipop::ConvergenceCriteria criteria{0.01, 0.01, 5};
+  int calls = 0;
+  criteria.best_response_gap = [&calls] {
+    ++calls;
+    return 1.0;
+  };
+  criteria.gap_tolerance = 0.1;
+  driver.SetConvergenceCriteria(criteria);
+  EXPECT_FALSE(driver.RunUntilConverged(200));
+  EXPECT_GT(calls, 0);
+  EXPECT_LT(calls, 200);
+
+  auto close = MakeDriver();
+  criteria.best_response_gap = [] { return 0.05; };
+  close.SetConvergenceCriteria(criteria);
+  EXPECT_TRUE(close.RunUntilConverged(500));
+}
+
+TEST_F(ConvergenceTest, RoundCapTest) {
+  auto driver = MakeDriver();
+  driver.SetConvergenceCriteria({0, 0, 1000});
+  EXPECT_FALSE(driver.RunUntilConverged(20));
+  EXPECT_EQ(20, driver.GetRoundCount());
+}
+
+}  // namespace gatests
@@ -0,0 +1,66 @@
+#ifndef GATESTS_GENERICGA_FLOAT_GA_H_
+#define GATESTS_GENERICGA_FLOAT_GA_H_
+
+#include <functional>
+#include <memory>
+#include <random>
+#include <vector>
+
+#include "genericga/binary/bit_mutator.h"
+#include "genericga/binary/byte_array_genotype.h"
+#include "genericga/binary/float_encoding.h"
+#include "genericga/binary/single_point_crossover.h"
+#include "genericga/children_factory.h"
+#include "genericga/population.h"
+#include "genericga/random.h"
+#include "genericga/selector/elitism_decorator.h"
+#include "genericga/selector/tournament.h"
+#include "genericga/single_population_ga.h"
+
+namespace gatests {
+
+// A GA of 20 two-byte genotypes encoding a bid in [0, 1], drawn from a new
+// stream of the run seed, for tests that drive it from a multipop::GA.  Its
+// own fitness is a placeholder until a sub-GA adapter sets the environment's.
+// tournament_survivors replaces SinglePopulationGA's default survivor
+// selection with binary tournaments that keep the best genotype.
+inline std::unique_ptr<
+    genericga::SinglePopulationGA<genericga::binary::ByteArrayGenotype, float>>
+MakeFloatGA(bool tournament_survivors = false) {
+  using namespace genericga;
+  using binary::ByteArrayGenotype;
+  binary::FloatEncoding encoding(0, 1, 16);
+  std::function<float(const ByteArrayGenotype&)> conversion =
+      [encoding](const ByteArrayGenotype& gene) {
+        return gene.ToFloatArray({encoding})[0];
+      };
+  std::function<std::vector<float>(const std::vector<float>&)> fitness =
+      [](const std::vector<float>& phens) {
+        return std::vector<float>(phens.size(), 0);
+      };
+  auto gen = MakeStream();
+  std::uniform_int_distribution<int> dist(0, 255);
+  std::vector<ByteArrayGenotype> genes;
+  for (int i = 0; i < 20; ++i) {
+    genes.emplace_back(std::vector<unsigned char>{
+        static_cast<unsigned char>(dist(gen)),
+        static_cast<unsigned char>(dist(gen))});
+  }
+  auto children = std::make_unique<ChildrenFactory<ByteArrayGenotype>>(
+      std::make_unique<binary::SinglePointCrossover>(),
+      std::make_unique<binary::BitMutator>(1),
+      std::make_unique<selector::Tournament>(2));
+  Population<ByteArrayGenotype, float> pop(conversion, fitness, genes);
+  if (!tournament_survivors) {
+    return std::make_unique<SinglePopulationGA<ByteArrayGenotype, float>>(
+        std::move(pop), std::move(children));
+  }
+  return std::make_unique<SinglePopulationGA<ByteArrayGenotype, float>>(
+      std::move(pop), std::move(children),
+      std::make_unique<selector::ElitismDecorator>(
+          std::make_unique<selector::Tournament>(2), 1));
+}
+
+}  // namespace gatests
+
+#endif  // GATESTS_GENERICGA_FLOAT_GA_H_
@@ -0,0 +1,164 @@
+#include <gtest/gtest.h>
+
+#include <functional>
+#include <memory>
+#include <random>
+#include <sstream>
+#include <vector>
+
+#include "genericga/binary/byte_array_genotype.h"
+#include "genericga/binary/float_encoding.h"
+#include "genericga/binary/float_local_search.h"
+#include "genericga/children_factory.h"
+#include "genericga/local_search.h"
+#include "genericga/population.h"
+#include "genericga/random.h"
+#include "genericga/real/modify_mutation.h"
+#include "genericga/real/single_point_crossover.h"
+#include "genericga/selector/elitism_decorator.h"
+#include "genericga/selector/ranked_weighted.h"
+#include "genericga/single_population_ga.h"
+
+namespace gatests {
+
+using namespace genericga;
+using binary::ByteArrayGenotype;
+using binary::FloatEncoding;
+using RealGen = std::vector<double>;
+
+// The negative squared distance to a ramp from 0.1 to 0.9, the shape of a
+// smooth bid function.
+std::vector<float> RampFitness(const std::vector<RealGen>& points) {
+  std::vector<float> fits;
+  for (const auto& point : points) {
+    double dist = 0;
+    for (int i = 0; i < point.size(); ++i) {
+      double target = 0.1 + 0.8 * i / (point.size() - 1);
+      dist += (point[i] - target) * (point[i] - target);
+    }
+    fits.push_back(-dist);
+  }
+  return fits;
+}
+
+class LocalSearchTest : public ::testing::Test {
+ public:
+  LocalSearchTest() {}
+
+ protected:
+  virtual void SetUp() { SetRunSeed(5); }
+  static SinglePopulationGA<RealGen, RealGen> MakeGA() {
+    auto gen = MakeStream();
+    std::uniform_real_distribution<> dist(0, 1);
+    std::vector<RealGen> genes;
+    for (int i = 0; i < 20; ++i) {
+      RealGen gene(kDims);
+      for (double& x : gene) {
+        x = dist(gen);
+      }
+      genes.push_back(gene);
+    }
+    std::function<RealGen(const RealGen&)> identity = [](const RealGen& g) {
+      return g;
+    };
+    auto children = std::make_unique<ChildrenFactory<RealGen>>(
+        std::make_unique<real::SinglePointCrossover>(),
+        std::make_unique<real::ModifyMutation>(1, 0.1, 0, 1));
+    return SinglePopulationGA<RealGen, RealGen>(
+        Population<RealGen, RealGen>(identity, RampFitness, genes),
+        std::move(children));
+  }
+
+  static constexpr int kDims = 11;
+};
+
+TEST_F(LocalSearchTest, SetFloatArrayRoundTripTest) {
+  std::vector<FloatEncoding> encodings{FloatEncoding(0, 1, 16),
+                                       FloatEncoding(-5, 5, 12, false),
+                                       FloatEncoding(-1, 3, 32)};
+  ByteArrayGenotype gene(std::vector<unsigned char>(8, 0xA5));
+  gene.SetFloatArray({0.3f, -4.2f, 2.5f}, encodings);
+  std::vector<float> values = gene.ToFloatArray(encodings);
+  EXPECT_NEAR(values[0], 0.3, 1e-4);
+  EXPECT_NEAR(values[1], -4.2, 1e-2);
+  EXPECT_NEAR(values[2], 2.5, 1e-6);
+  // Out of range values land on the nearest end, and bits past the encodings
+  // are untouched.
+  gene.SetFloatArray({2, -9, 3}, encodings);
+  values = gene.ToFloatArray(encodings);
+  EXPECT_NEAR(values[0], 1, 1e-4);
+  EXPECT_FLOAT_EQ(values[1], -5);
+  EXPECT_NEAR(values[2], 3, 1e-6);
+  EXPECT_EQ(gene.FromBits(60, 4), 0x5);
+}
+
+TEST_F(LocalSearchTest, CoordinateSearchTest) {
+  CoordinateSearch search(RealGen(kDims, 0), RealGen(kDims, 1), 20, 0.1);
+  RealGen start(kDims, 0.5);
+  auto improved = search(start, RampFitness);
+  ASSERT_EQ(improved.size(), 1);
+  EXPECT_GT(RampFitness(improved)[0], -1e-3);
+  // Nothing is returned from the optimum.
+  RealGen optimum(kDims);
+  for (int i = 0; i < kDims; ++i) {
+    optimum[i] = 0.1 + 0.8 * i / (kDims - 1);
+  }
+  EXPECT_TRUE(search(optimum, RampFitness).empty());
+}
+
+TEST_F(LocalSearchTest, FloatLocalSearchTest) {
+  std::vector<FloatEncoding> encodings(kDims, FloatEncoding(0, 1, 16));
+  binary::FloatLocalSearch search(encodings, 20, 0.1);
+  ByteArrayGenotype start(std::vector<unsigned char>(2 * kDims, 0));
+  GenotypeFitness<ByteArrayGenotype> fitness =
+      [&encodings](const std::vector<ByteArrayGenotype>& genes) {
+        std::vector<RealGen> points;
+        for (const auto& gene : genes) {
+          auto values = gene.ToFloatArray(encodings);
+          points.emplace_back(values.begin(), values.end());
+        }
+        return RampFitness(points);
+      };
+  auto improved = search(start, fitness);
+  ASSERT_EQ(improved.size(), 1);
+  EXPECT_GT(fitness(improved)[0], -1e-3);
+}
+
+TEST_F(LocalSearchTest, MemeticConvergenceTest) {
+  auto plain = MakeGA();
+  auto memetic = MakeGA();
+  memetic.SetLocalSearch(
+      CoordinateSearch(RealGen(kDims, 0), RealGen(kDims, 1), 5, 0.1), 5);
+  plain.RunRound(50);
+  memetic.RunRound(50);
+  float plain_fit = plain.GetBestStrategy().fitness;
+  float memetic_fit = memetic.GetBestStrategy().fitness;
+  EXPECT_GT(memetic_fit, -1e-3);
+  EXPECT_GT(memetic_fit, 10 * plain_fit);
+}
+
+// A run resumed between searches still searches on the original rounds.
+TEST_F(LocalSearchTest, ResumeTest) {
+  CoordinateSearch search(RealGen(kDims, 0), RealGen(kDims, 1), 5, 0.1);
+  auto original = MakeGA();
+  original.SetLocalSearch(search, 5);
+  original.RunRound(7);
+  std::stringstream checkpoint;
+  original.SaveCheckpoint(checkpoint);
+  original.RunRound(6);
+
+  SetRunSeed(6);
+  auto resumed = MakeGA();
+  resumed.SetLocalSearch(search, 5);
+  resumed.LoadCheckpoint(checkpoint);
+  resumed.RunRound(6);
+
+  auto expected = original.GetBestStrategies(20);
+  auto actual = resumed.GetBestStrategies(20);
+  for (int i = 0; i < 20; ++i) {
+    EXPECT_EQ(expected[i].phenotype, actual[i].phenotype);
+    EXPECT_EQ(expected[i].fitness, actual[i].fitness);
+  }
+}
+
+}  // namespace gatests
@@ -0,0 +1,159 @@
+#include <gtest/gtest.h>
+
+#include <omp.h>
+#include <functional>
+#include <memory>
+#include <random>
+#include <vector>
+
+#include "genericga/abstract_single_population_ga.h"
+#include "genericga/children_factory.h"
+#include "genericga/composite_ga.h"
+#include "genericga/multipop/abstract_sub_ga.h"
+#include "genericga/multipop/ga.h"
+#include "genericga/multipop/sub_ga_adapter.h"
+#include "genericga/phenotype_strategy.h"
+#include "genericga/population.h"
+#include "genericga/random.h"
+#include "genericga/real/modify_mutation.h"
+#include "genericga/real/single_point_crossover.h"
+#include "genericga/single_population_ga.h"
+
+namespace gatests {
+
+using namespace genericga;
+using RealGen = std::vector<double>;
+
+// The negative squared distance to the middle of the unit cube.
+std::vector<float> CenterFitness(const std::vector<RealGen>& points) {
+  std::vector<float> fits;
+  for (const auto& point : points) {
+    double dist = 0;
+    for (double x : point) {
+      dist += (x - 0.5) * (x - 0.5);
+    }
+    fits.push_back(-dist);
+  }
+  return fits;
+}
+
+// Each player is rewarded for a point close to the other players' points.
+class ClusterEnvironment {
+ public:
+  void AcceptStrategy(const RealGen& point, int id) { points_[id] = point; }
+  float GetFitness(const RealGen& point, int id) const {
+    double dist = 0;
+    for (int j = 0; j < static_cast<int>(points_.size()); ++j) {
+      if (j != id) {
+        for (int k = 0; k < static_cast<int>(point.size()); ++k) {
+          dist += (point[k] - points_[j][k]) * (point[k] - points_[j][k]);
+        }
+      }
+    }
+    return -dist;
+  }
+
+ private:
+  std::vector<RealGen> points_ = std::vector<RealGen>(3, RealGen(4, 0.5));
+};
+
+using SubGA = multipop::SubGAAdapter<ClusterEnvironment, RealGen>;
+
+// Runs the same seeded GAs on one thread and on several, which must agree
+// exactly since every component draws only from its own random streams.
+class ParallelTest : public ::testing::Test {
+ public:
+  ParallelTest() {}
+
+ protected:
+  virtual void SetUp() { max_threads_ = omp_get_max_threads(); }
+  virtual void TearDown() { omp_set_num_threads(max_threads_); }
+
+  static std::unique_ptr<SinglePopulationGA<RealGen, RealGen>> MakeGA() {
+    auto gen = MakeStream();
+    std::uniform_real_distribution<> dist(0, 1);
+    std::vector<RealGen> genes;
+    for (int i = 0; i < 20; ++i) {
+      RealGen gene(4);
+      for (double& x : gene) {
+        x = dist(gen);
+      }
+      genes.push_back(gene);
+    }
+    std::function<RealGen(const RealGen&)> identity = [](const RealGen& g) {
+      return g;
+    };
+    auto children = std::make_unique<ChildrenFactory<RealGen>>(
+        std::make_unique<real::SinglePointCrossover>(),
+        std::make_unique<real::ModifyMutation>(1, 0.1, 0, 1));
+    return std::make_unique<SinglePopulationGA<RealGen, RealGen>>(
+        Population<RealGen, RealGen>(identity, CenterFitness, genes),
+        std::move(children));
+  }
+
+  // The best strategy of a composite of four components after 10 rounds.
+  static PhenotypeStrategy<RealGen> RunComposite(int n_threads) {
+    omp_set_num_threads(n_threads);
+    SetRunSeed(3);
+    std::vector<std::shared_ptr<AbstractSinglePopulationGA<RealGen>>> gas;
+    for (int i = 0; i < 4; ++i) {
+      gas.push_back(MakeGA());
+    }
+    // Concatenates the components' strategies.
+    auto combiner = [](const std::vector<PhenotypeStrategy<RealGen>>& strats) {
+      PhenotypeStrategy<RealGen> combined{{}, 0};
+      for (const auto& strat : strats) {
+        combined.phenotype.insert(combined.phenotype.end(),
+                                  strat.phenotype.begin(),
+                                  strat.phenotype.end());
+        combined.fitness += strat.fitness;
+      }
+      return combined;
+    };
+    CompositeGA<RealGen> composite(gas, combiner);
+    composite.RunRound(10);
+    return composite.GetBestStrategy();
+  }
+
+  // Each player's best strategy after 10 rounds of three sub-GAs that share
+  // a tier, from batches of two environments out of a memory of three.
+  static std::vector<PhenotypeStrategy<RealGen>> RunTier(int n_threads) {
+    omp_set_num_threads(n_threads);
+    SetRunSeed(4);
+    std::vector<std::shared_ptr<SubGA>> sub_gas;
+    std::vector<std::shared_ptr<multipop::AbstractSubGA<ClusterEnvironment>>>
+        gas;
+    for (int id = 0; id < 3; ++id) {
+      sub_gas.push_back(std::make_shared<SubGA>(MakeGA(), id));
+      gas.push_back(sub_gas.back());
+    }
+    multipop::GA<ClusterEnvironment> driver(gas, ClusterEnvironment(), 2, 3);
+    driver.RunRound(10);
+    std::vector<PhenotypeStrategy<RealGen>> best;
+    for (const auto& ga : sub_gas) {
+      best.push_back(ga->GetBestStrategy());
+    }
+    return best;
+  }
+
+  int max_threads_ = 1;
+};
+
+TEST_F(ParallelTest, CompositeThreadCountTest) {
+  auto serial = RunComposite(1);
+  auto parallel = RunComposite(4);
+  ASSERT_EQ(16, serial.phenotype.size());
+  EXPECT_EQ(serial.phenotype, parallel.phenotype);
+  EXPECT_EQ(serial.fitness, parallel.fitness);
+}
+
+TEST_F(ParallelTest, TierThreadCountTest) {
+  auto serial = RunTier(1);
+  auto parallel = RunTier(4);
+  for (int id = 0; id < 3; ++id) {
+    EXPECT_EQ(serial[id].phenotype, parallel[id].phenotype);
+    EXPECT_EQ(serial[id].fitness, parallel[id].fitness);
+  }
+}
+
+}  // namespace gatests
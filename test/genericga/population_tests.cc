@@ -0,0 +1,67 @@
+#include <gtest/gtest.h>
+
+#include <functional>
+#include <memory>
+#include <vector>
+
+#include "genericga/children_factory.h"
+#include "genericga/population.h"
+#include "genericga/real/modify_mutation.h"
+#include "genericga/real/single_point_crossover.h"
+#include "genericga/selector/keep_best.h"
+
+namespace gatests {
+
+using namespace genericga;
+using RealGen = std::vector<double>;
+
+// Ten one-dimensional genotypes 0, 0.1, ..., 0.9, each as fit as its value.
+class PopulationTest : public ::testing::Test {
+ public:
+  PopulationTest() {}
+
+ protected:
+  virtual void SetUp() {
+    std::vector<RealGen> genes;
+    for (int i = 0; i < 10; ++i) {
+      genes.push_back({i / 10.0});
+    }
+    std::function<RealGen(const RealGen&)> identity = [](const RealGen& g) {
+      return g;
+    };
+    std::function<std::vector<float>(const std::vector<RealGen>&)> fitness =
+        [](const std::vector<RealGen>& phens) {
+          std::vector<float> fits;
+          for (const auto& phen : phens) {
+            fits.push_back(phen[0]);
+          }
+          return fits;
+        };
+    pop = std::make_unique<Population<RealGen, RealGen>>(identity, fitness,
+                                                         genes);
+  }
+
+  std::unique_ptr<Population<RealGen, RealGen>> pop;
+  selector::KeepBest keep_best;
+};
+
+TEST_F(PopulationTest, SelectGenotypesTest) {
+  auto selected = pop->SelectGenotypes(keep_best, 3);
+  ASSERT_EQ(3, selected.size());
+  EXPECT_EQ(RealGen{0.9}, selected[0]);
+  EXPECT_EQ(RealGen{0.8}, selected[1]);
+  EXPECT_EQ(RealGen{0.7}, selected[2]);
+  EXPECT_EQ(RealGen{0.9}, pop->SelectGenotype(keep_best));
+}
+
+TEST_F(PopulationTest, ChildCountTest) {
+  ChildrenFactory<RealGen> children(
+      std::make_unique<real::SinglePointCrossover>(),
+      std::make_unique<real::ModifyMutation>(1, 0.1, 0, 1),
+      std::make_unique<selector::KeepBest>());
+  EXPECT_EQ(4, children.GetChildren(*pop, 4).size());
+  EXPECT_EQ(3, children.GetChildren(*pop, 3).size());
+  EXPECT_TRUE(children.GetChildren(*pop, 0).empty());
+}
+
+}  // namespace gatests
@@ -0,0 +1,61 @@
+#include <gtest/gtest.h>
+
+#include <sstream>
+#include <string>
+
+#include "genericga/profile.h"
+
+namespace gatests {
+
+using namespace genericga;
+
+class ProfileLogTest : public ::testing::Test {
+ public:
+  ProfileLogTest() {}
+
+ protected:
+  virtual void SetUp() {
+    log.AddTime("crossover", 0.5);
+    log.AddTime("crossover", 0.25);
+    log.AddCount("fitness_evals", 10);
+    log.NextGeneration();
+    log.AddTime("mutation", 1);
+    log.NextGeneration();
+    // Left open, so never reported.
+    log.AddTime("crossover", 8);
+  }
+  ProfileLog log;
+};
+
+TEST_F(ProfileLogTest, AccumulateTest) {
+  EXPECT_EQ(2, log.GetGenerationCount());
+  EXPECT_DOUBLE_EQ(0.75, log.GetTime(0, "crossover"));
+  EXPECT_EQ(10, log.GetCount(0, "fitness_evals"));
+  EXPECT_DOUBLE_EQ(0, log.GetTime(0, "mutation"));
+  EXPECT_DOUBLE_EQ(1, log.GetTime(1, "mutation"));
+  EXPECT_EQ(0, log.GetCount(1, "fitness_evals"));
+}
+
+TEST_F(ProfileLogTest, CSVTest) {
+  std::ostringstream os;
+  log.WriteCSV(os);
+  EXPECT_EQ(
+      "generation,crossover,mutation,fitness_evals\n"
+      "0,0.75,0,10\n"
+      "1,0,1,0\n",
+      os.str());
+}
+
+TEST_F(ProfileLogTest, JSONTest) {
+  std::ostringstream os;
+  log.WriteJSON(os);
+  EXPECT_EQ(
+      "[\n"
+      "  {\"generation\": 0, \"times\": {\"crossover\": 0.75}, "
+      "\"counts\": {\"fitness_evals\": 10}},\n"
+      "  {\"generation\": 1, \"times\": {\"mutation\": 1}, \"counts\": {}}\n"
+      "]\n",
+      os.str());
+}
+
+}  // namespace gatests
@@ -0,0 +1,68 @@
+#include <gtest/gtest.h>
+
+#include <cstdint>
+#include <vector>
+
+#include "genericga/random.h"
+
+namespace gatests {
+
+using namespace genericga;
+
+class PhiloxTest : public ::testing::Test {
+ public:
+  PhiloxTest() {}
+
+ protected:
+  virtual void SetUp() {}
+  std::vector<std::uint32_t> Draw(Philox4x32 gen, int n) {
+    std::vector<std::uint32_t> out(n);
+    for (auto& val : out) {
+      val = gen();
+    }
+    return out;
+  }
+};
+
+// Reference output from the Random123 known-answer tests.
+TEST_F(PhiloxTest, KnownAnswerTest) {
+  std::vector<std::uint32_t> expected{0x6627e8d5, 0xe169c58d, 0xbc57ac4c,
+                                      0x9b00dbd8};
+  EXPECT_EQ(expected, Draw(Philox4x32(0), 4));
+}
+
+TEST_F(PhiloxTest, SubstreamTest) {
+  Philox4x32 stream(42, 3);
+  Philox4x32 used = stream;
+  used();
+  EXPECT_EQ(Draw(stream.Substream(5, 7), 10),
+            Draw(used.Substream(5, 7), 10));
+  EXPECT_EQ(Draw(Philox4x32(42, 3, 5, 7), 10),
+            Draw(stream.Substream(5, 7), 10));
+  EXPECT_NE(Draw(stream.Substream(5, 7), 10),
+            Draw(stream.Substream(5, 8), 10));
+  EXPECT_NE(Draw(stream.Substream(5, 7), 10),
+            Draw(Philox4x32(42, 4).Substream(5, 7), 10));
+}
+
+TEST_F(PhiloxTest, DiscardTest) {
+  Philox4x32 gen(7);
+  Philox4x32 skipped(7);
+  for (int i = 0; i < 11; ++i) {
+    gen();
+  }
+  skipped.discard(11);
+  EXPECT_EQ(Draw(gen, 9), Draw(skipped, 9));
+}
+
+TEST_F(PhiloxTest, RunSeedTest) {
+  SetRunSeed(99);
+  auto first = MakeStream();
+  auto second = MakeStream();
+  SetRunSeed(99);
+  EXPECT_EQ(Draw(first, 8), Draw(MakeStream(), 8));
+  EXPECT_EQ(Draw(second, 8), Draw(MakeStream(), 8));
+  EXPECT_NE(Draw(first, 8), Draw(second, 8));
+}
+
+}  // namespace gatests
@@ -0,0 +1,53 @@
+#include <gtest/gtest.h>
+
+#include <chrono>
+#include <sstream>
+#include <string>
+#include <thread>
+
+#include "genericga/trace.h"
+
+namespace gatests {
+
+using namespace genericga;
+
+class TraceSinkTest : public ::testing::Test {
+ public:
+  TraceSinkTest() {}
+
+ protected:
+  virtual void SetUp() {}
+  std::string Write() {
+    std::ostringstream os;
+    sink.WriteJSON(os);
+    return os.str();
+  }
+  TraceSink sink;
+};
+
+TEST_F(TraceSinkTest, SpanTest) {
+  auto start = TraceSink::Clock::now();
+  sink.AddSpan("round", start, start + std::chrono::microseconds(250));
+  std::string json = Write();
+  EXPECT_NE(std::string::npos,
+            json.find("{\"name\": \"round\", \"ph\": \"X\", \"pid\": 0, "
+                      "\"tid\": 0, \"ts\": "));
+  EXPECT_NE(std::string::npos, json.find("\"dur\": 250.000}"));
+}
+
+TEST_F(TraceSinkTest, ThreadTest) {
+  sink.AddCounter("best_fitness_0", 0.25);
+  std::thread other([this] { sink.AddCounter("best_fitness_1", 0.5); });
+  other.join();
+  sink.AddCounter("best_fitness_0", 0.75);
+  EXPECT_EQ(3, sink.GetEventCount());
+  std::string json = Write();
+  EXPECT_NE(std::string::npos, json.find("\"args\": {\"name\": \"thread 1\"}"));
+  EXPECT_NE(std::string::npos,
+            json.find("\"name\": \"best_fitness_1\", \"ph\": \"C\", \"pid\": 0, "
+                      "\"tid\": 1"));
+  EXPECT_NE(std::string::npos, json.find("\"args\": {\"value\": 0.75}}"));
+  EXPECT_EQ(std::string::npos, json.find("\"tid\": 2"));
+}
+
+}  // namespace gatests
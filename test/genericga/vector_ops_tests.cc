@@ -0,0 +1,45 @@
+#include <gtest/gtest.h>
+
+#include <vector>
+
+#include "genericga/vector_ops.h"
+
+namespace gatests {
+
+using namespace genericga;
+
+class VectorOpsTest : public ::testing::Test {
+ public:
+  VectorOpsTest() {}
+
+ protected:
+  virtual void SetUp() {}
+  std::vector<float> vals{8, -3, 7, 2, -0.5, 7, 1e-3, -1e6};
+};
+
+TEST_F(VectorOpsTest, OrderingsTest) {
+  std::vector<int> expected{7, 1, 4, 6, 3, 2, 5, 0};
+  EXPECT_EQ(expected, GetOrderings(vals));
+}
+
+TEST_F(VectorOpsTest, RankingsTest) {
+  std::vector<int> expected{4, 1, 3, 0, 2};
+  EXPECT_EQ(expected, GetRankings(std::vector<float>{8, 3, 7, 2, 5}));
+}
+
+TEST_F(VectorOpsTest, MergeOrderingsTest) {
+  std::vector<float> head(vals.begin(), vals.begin() + 3);
+  std::vector<int> ordering = GetOrderings(head);
+  MergeOrderings(vals, ordering);
+  EXPECT_EQ(GetOrderings(vals), ordering);
+}
+
+TEST_F(VectorOpsTest, RankingsWithTiesTest) {
+  auto ordering = GetOrderings(vals);
+  std::vector<int> min_expected{7, 1, 5, 4, 2, 5, 3, 0};
+  std::vector<float> avg_expected{7, 1, 5.5, 4, 2, 5.5, 3, 0};
+  EXPECT_EQ(min_expected, GetRankingsWithTies(vals, ordering, MinRank));
+  EXPECT_EQ(avg_expected, GetRankingsWithTies(vals, AverageRank));
+}
+
+}  // namespace gatests
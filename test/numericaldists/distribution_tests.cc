@@ -0,0 +1,60 @@
+#include <gtest/gtest.h>
+
+#include <vector>
+
+#include "numericaldists/distribution.h"
+
+#include <boost/math/distributions.hpp>
+#include <eigen3/Eigen/Core>
+
+namespace gatests {
+
+using namespace numericaldists;
+using Eigen::ArrayXd;
+
+class DistributionTest : public ::testing::Test {
+ public:
+  DistributionTest() {}
+
+ protected:
+  virtual void SetUp() {}
+
+  // The array overloads against the scalar boost functions at xs and ps.
+  template <class T>
+  void ExpectMatchesBoost(const T& boost_dist) {
+    Distribution dist(boost_dist);
+    ArrayXd pdfs = pdf(dist, xs);
+    ArrayXd cdfs = cdf(dist, xs);
+    ArrayXd quantiles = quantile(dist, ps);
+    for (int i = 0; i < xs.size(); ++i) {
+      EXPECT_NEAR(boost::math::pdf(boost_dist, xs(i)), pdfs(i), epsilon);
+      EXPECT_NEAR(boost::math::cdf(boost_dist, xs(i)), cdfs(i), epsilon);
+    }
+    for (int i = 0; i < ps.size(); ++i) {
+      EXPECT_NEAR(boost::math::quantile(boost_dist, ps(i)), quantiles(i),
+                  epsilon);
+    }
+  }
+
+  ArrayXd xs = ArrayXd::LinSpaced(41, 0, 4);
+  ArrayXd ps = ArrayXd::LinSpaced(19, 0.05, 0.95);
+  double epsilon = 1e-12;
+};
+
+TEST_F(DistributionTest, UniformTest) {
+  ExpectMatchesBoost(boost::math::uniform_distribution<>(1, 3));
+}
+
+TEST_F(DistributionTest, NormalTest) {
+  ExpectMatchesBoost(boost::math::normal_distribution<>(2, 0.5));
+}
+
+TEST_F(DistributionTest, ExponentialTest) {
+  ExpectMatchesBoost(boost::math::exponential_distribution<>(1.5));
+}
+
+TEST_F(DistributionTest, GenericTest) {
+  ExpectMatchesBoost(boost::math::triangular_distribution<>(0, 1, 4));
+}
+
+}  // namespace gatests
@@ -0,0 +1,107 @@
+#include <gtest/gtest.h>
+
+#include <vector>
+
+#include "numericaldists/piecewise_linear.h"
+
+#include <eigen3/Eigen/Core>
+
+namespace gatests {
+
+using namespace numericaldists;
+using Eigen::ArrayXd;
+
+class PiecewiseLinearTest : public ::testing::Test {
+ public:
+  PiecewiseLinearTest() {}
+
+ protected:
+  virtual void SetUp() {}
+
+  PiecewiseLinear Make(std::vector<double> xs, std::vector<double> ys) {
+    return PiecewiseLinear(Eigen::Map<ArrayXd>(xs.data(), xs.size()),
+                           Eigen::Map<ArrayXd>(ys.data(), ys.size()));
+  }
+
+  float epsilon = 1e-12;
+};
+
+TEST_F(PiecewiseLinearTest, EvaluateTest) {
+  auto func = Make({0, 1, 1, 3}, {0, 1, 2, 4});
+  EXPECT_NEAR(0, func(-1), epsilon);
+  EXPECT_NEAR(0.5, func(0.5), epsilon);
+  EXPECT_NEAR(2, func(1), epsilon);
+  EXPECT_NEAR(1, func.LeftLimit(1), epsilon);
+  EXPECT_NEAR(3, func(2), epsilon);
+  EXPECT_NEAR(4, func(5), epsilon);
+}
+
+TEST_F(PiecewiseLinearTest, SimplifiedTest) {
+  PiecewiseLinear flat(ArrayXd::LinSpaced(101, 0, 1), ArrayXd::Constant(101, 2));
+  EXPECT_EQ(2, flat.Simplified().xs().size());
+  auto kinked = Make({0, 1, 2, 3}, {0, 1, 2, 0});
+  EXPECT_EQ(3, kinked.Simplified().xs().size());
+}
+
+TEST_F(PiecewiseLinearTest, IntegrateProductTest) {
+  auto identity = Make({0, 1}, {0, 1});
+  auto tent = Make({0, 0.5, 1}, {0, 1, 0});
+  EXPECT_NEAR(0.25, IntegrateProduct({&identity, &identity, &identity}, 0, 1),
+              epsilon);
+  // Integral of x * tent(x) over [0, 1] is 1 / 4.
+  EXPECT_NEAR(0.25, IntegrateProduct({&identity, &tent}, 0, 1), epsilon);
+  EXPECT_NEAR(0.25, IntegrateProduct({&tent}, 0, 0.5), epsilon);
+}
+
+TEST_F(PiecewiseLinearTest, UniformImageCDFTest) {
+  auto half = UniformImageCDF(Make({0, 1}, {0, 0.5}));
+  EXPECT_NEAR(0.5, half(0.25), epsilon);
+  EXPECT_NEAR(1, half(0.5), epsilon);
+
+  // Bids 0.2 for values below 0.5, then rise to 0.7.
+  auto kinked = UniformImageCDF(Make({0, 0.5, 1}, {0.2, 0.2, 0.7}));
+  EXPECT_NEAR(0, kinked.LeftLimit(0.2), epsilon);
+  EXPECT_NEAR(0.5, kinked(0.2), epsilon);
+  EXPECT_NEAR(0.75, kinked(0.45), epsilon);
+}
+
+TEST_F(PiecewiseLinearTest, ComposeTest) {
+  auto cdf = UniformImageCDF(Make({0, 1}, {0, 0.5}));
+  auto bids = Make({0, 1}, {0, 1});
+  auto win_probs = Compose(cdf, bids);
+  EXPECT_NEAR(0.6, win_probs(0.3), epsilon);
+  EXPECT_NEAR(1, win_probs(0.8), epsilon);
+
+  // Against a constant bidder a matching constant bid ties.
+  auto constant = UniformImageCDF(Make({0, 1}, {0.2, 0.2}));
+  auto tie = Compose(constant, Make({0, 1}, {0.2, 0.2}));
+  EXPECT_NEAR(0.5, tie(0.5), epsilon);
+  auto decreasing = Compose(constant, Make({0, 1}, {0.4, 0}));
+  EXPECT_NEAR(1, decreasing(0.4), epsilon);
+  EXPECT_NEAR(0, decreasing(0.6), epsilon);
+}
+
+TEST_F(PiecewiseLinearTest, ComposeEachTest) {
+  // Three constant bidders tie, and each wins a third of the time.
+  auto constant = UniformImageCDF(Make({0, 1}, {0.2, 0.2}));
+  auto tied = Make({0, 1}, {0.2, 0.2});
+  auto three = ComposeEach({&constant, &constant}, tied);
+  ASSERT_EQ(2, three.size());
+  EXPECT_NEAR(1.0 / 3, three[0](0.5) * three[1](0.5), epsilon);
+  // Two match the single opponent Compose.
+  auto two = ComposeEach({&constant}, tied);
+  EXPECT_NEAR(Compose(constant, tied)(0.5), two[0](0.5), epsilon);
+
+  // Against a constant bidder and one uniform on [0, 0.4], the uniform one
+  // bids less half the time and the tie is then split.
+  auto uniform = UniformImageCDF(Make({0, 1}, {0, 0.4}));
+  auto mixed = ComposeEach({&constant, &uniform}, tied);
+  EXPECT_NEAR(0.25, mixed[0](0.5) * mixed[1](0.5), epsilon);
+  // Off the ties the results are the plain compositions.
+  auto rising = Make({0, 1}, {0, 0.4});
+  auto plain = ComposeEach({&constant, &uniform}, rising);
+  EXPECT_NEAR(Compose(uniform, rising)(0.3), plain[1](0.3), epsilon);
+  EXPECT_NEAR(1, plain[0](0.8), epsilon);
+}
+
+}  // namespace gatests
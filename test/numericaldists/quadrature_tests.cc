@@ -0,0 +1,49 @@
+#include <gtest/gtest.h>
+
+#include <cmath>
+
+#include "numericaldists/quadrature.h"
+
+#include <eigen3/Eigen/Core>
+
+namespace gatests {
+
+using namespace numericaldists;
+using Eigen::ArrayXd;
+
+class QuadratureTest : public ::testing::Test {
+ public:
+  QuadratureTest() {}
+
+ protected:
+  virtual void SetUp() {}
+};
+
+TEST_F(QuadratureTest, PolynomialTest) {
+  auto poly = [](const ArrayXd& xs) {
+    return ArrayXd(3 * xs.pow(5) - xs.square() + 2);
+  };
+  auto result = IntegrateAdaptive(poly, -1, 2, 1e-10);
+  EXPECT_NEAR(3 * 64.0 / 6 - 8.0 / 3 + 4 - (3.0 / 6 + 1.0 / 3 - 2),
+              result.value, 1e-10);
+  EXPECT_EQ(15, result.n_evals);
+}
+
+TEST_F(QuadratureTest, KinkTest) {
+  auto kinked = [](const ArrayXd& xs) { return ArrayXd((xs - 0.3).abs()); };
+  auto result = IntegrateAdaptive(kinked, 0, 1, 1e-8);
+  EXPECT_NEAR(0.29, result.value, 1e-8);
+  EXPECT_LE(result.error, 1e-8);
+  EXPECT_GT(result.n_evals, 15);
+}
+
+TEST_F(QuadratureTest, MaxIntervalsTest) {
+  auto step = [](const ArrayXd& xs) {
+    return ArrayXd((xs < std::sqrt(0.5)).cast<double>());
+  };
+  auto result = IntegrateAdaptive(step, 0, 1, 0, 20);
+  EXPECT_EQ(15 + 19 * 30, result.n_evals);
+  EXPECT_NEAR(std::sqrt(0.5), result.value, 1e-4);
+}
+
+}  // namespace gatests